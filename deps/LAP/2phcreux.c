@@ -0,0 +1,627 @@
+/**--------------------------------------------------
+
+    \file 2phcreux.c
+    \brief Determination des solutions efficaces du probleme bicritere d'affectation creux
+
+    Meme methode en deux phases que 2phrpasf2.c, mais seuls les arcs admissibles sont stockes
+    (format CSR) : les problemes ponderes sont resolus par plus courts chemins augmentants et
+    le ranking ne parcourt que les arcs admissibles. Memoire et temps dependent du nombre d'arcs
+    et non plus de nSize * nSize.
+
+ -------------------------------------------------*/
+
+#include "2phcreux.h"
+
+
+/* ---------------------------------- listes de solutions ------------------------------------ */
+
+void initListeCreuse(listecreuse *L,int nSize)
+{
+L->lgListe = 0;
+L->taille = 64;
+L->X = (int *) malloc (L->taille * nSize * sizeof(int));
+L->z1 = (int *) malloc (L->taille * sizeof(int));
+L->z2 = (int *) malloc (L->taille * sizeof(int));
+}
+
+void libererListeCreuse(listecreuse *L)
+{
+free(L->X);
+free(L->z1);
+free(L->z2);
+}
+
+/* insere la solution X de valeurs (z1,z2) en position k, en decalant les suivantes */
+
+void insererListeCreuse(listecreuse *L,int nSize,int k,int *X,int z1,int z2)
+{
+int i;
+if (L->lgListe == L->taille)
+    {
+    L->taille *= 2;
+    L->X = (int *) realloc (L->X,L->taille * nSize * sizeof(int));
+    L->z1 = (int *) realloc (L->z1,L->taille * sizeof(int));
+    L->z2 = (int *) realloc (L->z2,L->taille * sizeof(int));
+    }
+for(i = L->lgListe;i > k;i--)
+    {
+    L->z1[i] = L->z1[i - 1];
+    L->z2[i] = L->z2[i - 1];
+    }
+for(i = (L->lgListe - k) * nSize - 1;i >= 0;i--) L->X[(k + 1) * nSize + i] = L->X[k * nSize + i];
+for(i = 0;i < nSize;i++) L->X[k * nSize + i] = X[i];
+L->z1[k] = z1;
+L->z2[k] = z2;
+L->lgListe++;
+}
+
+/* tri par insertion suivant z1 des solutions d'indices debut a L->lgListe - 1 */
+
+void trierListeCreuse(listecreuse *L,int nSize,int debut)
+{
+int i,j,k,t;
+for(i = debut + 1;i < L->lgListe;i++)
+    for(j = i;(j > debut) && (L->z1[j - 1] > L->z1[j]);j--)
+        {
+        t = L->z1[j]; L->z1[j] = L->z1[j - 1]; L->z1[j - 1] = t;
+        t = L->z2[j]; L->z2[j] = L->z2[j - 1]; L->z2[j - 1] = t;
+        for(k = 0;k < nSize;k++)
+            {
+            t = L->X[j * nSize + k];
+            L->X[j * nSize + k] = L->X[(j - 1) * nSize + k];
+            L->X[(j - 1) * nSize + k] = t;
+            }
+        }
+}
+
+int isMemberCreux(int z1,int z2,listecreuse *L,int debut)
+{
+int i;
+for(i = debut;i < L->lgListe;i++)
+    if ((L->z1[i] == z1) && (L->z2[i] == z2)) return 1;
+return 0;
+}
+
+int estdomineeCreux(int z1,int z2,listecreuse *L,int debut)
+{
+int i;
+for(i = debut;i < L->lgListe;i++)
+    if (    ((z1 >= L->z1[i]) && (z2 >  L->z2[i]))
+         || ((z1 >  L->z1[i]) && (z2 >= L->z2[i])) )
+    return 1;
+return 0;
+}
+
+/* --------------------------------- espace de travail --------------------------------------- */
+
+espacecreux *creerEspaceCreux(graphecreux *g)
+{
+int i,e,n = g->nSize,m = g->nbArcs;
+espacecreux *ws = (espacecreux *) malloc (sizeof(espacecreux));
+ws->Cd = (long long *) malloc (m * sizeof(long long));
+ws->u = (long long *) malloc (n * sizeof(long long));
+ws->v = (long long *) malloc (n * sizeof(long long));
+ws->dist = (long long *) malloc (2 * n * sizeof(long long));
+ws->predArc = (int *) malloc (n * sizeof(int));
+ws->ligneDe = (int *) malloc (n * sizeof(int));
+ws->etat = (char *) calloc (2 * n,sizeof(char));
+ws->touches = (int *) malloc (2 * n * sizeof(int));
+ws->nbTouches = 0;
+ws->tasValeur = (long long *) malloc ((m + n) * sizeof(long long));
+ws->tasNoeud = (int *) malloc ((m + n) * sizeof(int));
+ws->tailleTas = 0;
+ws->vus = (int *) malloc (n * sizeof(int));
+ws->file = (int *) malloc (2 * n * sizeof(int));
+ws->fixe = (char *) calloc (n,sizeof(char));
+ws->interdit = (char *) calloc (m,sizeof(char));
+for(i = 0;i < 2 * n;i++) ws->dist[i] = INFINICREUX;
+
+g->ligne = (int *) malloc (m * sizeof(int));
+for(i = 0;i < n;i++)
+    for(e = g->debut[i];e < g->debut[i + 1];e++) g->ligne[e] = i;
+return ws;
+}
+
+void libererEspaceCreux(graphecreux *g,espacecreux *ws)
+{
+free(ws->Cd); free(ws->u); free(ws->v); free(ws->dist); free(ws->predArc); free(ws->ligneDe);
+free(ws->etat); free(ws->touches); free(ws->tasValeur); free(ws->tasNoeud); free(ws->vus);
+free(ws->file); free(ws->fixe); free(ws->interdit);
+free(ws);
+free(g->ligne);
+}
+
+/* remise a l'infini des labels modifies depuis la derniere reinitialisation */
+
+void reinitLabels(espacecreux *ws)
+{
+int k;
+for(k = 0;k < ws->nbTouches;k++)
+    {
+    ws->dist[ws->touches[k]] = INFINICREUX;
+    ws->etat[ws->touches[k]] = 0;
+    }
+ws->nbTouches = 0;
+}
+
+void TasCreuxAjouter(espacecreux *ws,long long value,int noeud)
+{
+int k = ws->tailleTas++,p;
+while( (k > 0) && (ws->tasValeur[p = (k - 1) / 2] > value) )
+    {
+    ws->tasValeur[k] = ws->tasValeur[p];
+    ws->tasNoeud[k] = ws->tasNoeud[p];
+    k = p;
+    }
+ws->tasValeur[k] = value;
+ws->tasNoeud[k] = noeud;
+}
+
+int TasCreuxExtraire(espacecreux *ws,long long *value)
+{
+int noeud = ws->tasNoeud[0],k = 0,f;
+long long vd = ws->tasValeur[--(ws->tailleTas)];
+int nd = ws->tasNoeud[ws->tailleTas];
+*value = ws->tasValeur[0];
+while( (f = 2 * k + 1) < ws->tailleTas )
+    {
+    if ( (f + 1 < ws->tailleTas) && (ws->tasValeur[f + 1] < ws->tasValeur[f]) ) f++;
+    if (ws->tasValeur[f] >= vd) break;
+    ws->tasValeur[k] = ws->tasValeur[f];
+    ws->tasNoeud[k] = ws->tasNoeud[f];
+    k = f;
+    }
+ws->tasValeur[k] = vd;
+ws->tasNoeud[k] = nd;
+return noeud;
+}
+
+/* ------------------------------ affectation ponderee -------------------------------------- */
+
+void combiConvexeCreux(long long deltaZ1,long long deltaZ2,graphecreux *g,long long *Cd)
+{
+int e;
+for(e = 0;e < g->nbArcs;e++) Cd[e] = deltaZ2 * g->C1[e] + deltaZ1 * g->C2[e];
+}
+
+int sapcreux(graphecreux *g,espacecreux *ws,int *X)
+{
+int n = g->nSize;
+int i,j,k,e,r,s,puits,nbVus;
+long long d,dmin = 0;
+long long *Cd = ws->Cd,*u = ws->u,*v = ws->v,*dist = ws->dist;
+
+/* solution duale initiale : u = 0 et v[j] = plus petit cout d'un arc arrivant en j */
+
+for(j = 0;j < n;j++)
+    {
+    v[j] = INFINICREUX;
+    ws->ligneDe[j] = - 1;
+    }
+for(i = 0;i < n;i++)
+    {
+    u[i] = 0;
+    X[i] = - 1;
+    for(e = g->debut[i];e < g->debut[i + 1];e++)
+        if (Cd[e] < v[g->colonne[e]]) v[g->colonne[e]] = Cd[e];
+    }
+for(j = 0;j < n;j++) if (v[j] == INFINICREUX) return 0;
+
+/* une ligne est affectee par iteration, par un plus court chemin en couts reduits (Dijkstra) */
+
+for(s = 0;s < n;s++)
+    {
+    ws->tailleTas = 0;
+    nbVus = 0;
+    puits = - 1;
+    r = s;
+    d = 0;
+    while(puits == - 1)
+        {
+        /* relaxation des arcs de la ligne r, atteinte avec le label d */
+        for(e = g->debut[r];e < g->debut[r + 1];e++)
+            {
+            k = g->colonne[e];
+            if (ws->etat[k] == 2) continue;
+            if (d + Cd[e] - u[r] - v[k] < dist[k])
+                {
+                if (dist[k] == INFINICREUX) ws->touches[ws->nbTouches++] = k;
+                dist[k] = d + Cd[e] - u[r] - v[k];
+                ws->predArc[k] = e;
+                TasCreuxAjouter(ws,dist[k],k);
+                }
+            }
+        /* colonne suivante rendue definitive */
+        j = - 1;
+        while( (ws->tailleTas > 0) && (j == - 1) )
+            {
+            j = TasCreuxExtraire(ws,&d);
+            if ( (ws->etat[j] == 2) || (d > dist[j]) ) j = - 1;
+            }
+        if (j == - 1)
+            {
+            reinitLabels(ws);
+            return 0;
+            }
+        ws->etat[j] = 2;
+        if (ws->ligneDe[j] == - 1)
+            {
+            puits = j;
+            dmin = d;
+            }
+        else
+            {
+            ws->vus[nbVus++] = j;
+            r = ws->ligneDe[j];
+            }
+        }
+
+    /* mise a jour des variables duales, les arcs du chemin deviennent serres */
+
+    u[s] += dmin;
+    for(k = 0;k < nbVus;k++)
+        {
+        j = ws->vus[k];
+        u[ws->ligneDe[j]] += dmin - dist[j];
+        v[j] -= dmin - dist[j];
+        }
+
+    /* augmentation le long du chemin */
+
+    j = puits;
+    do
+        {
+        e = ws->predArc[j];
+        r = g->ligne[e];
+        k = (X[r] == - 1) ? - 1 : g->colonne[X[r]];
+        X[r] = e;
+        ws->ligneDe[j] = r;
+        j = k;
+        }
+    while(r != s);
+
+    reinitLabels(ws);
+    }
+return 1;
+}
+
+void computeValueCreux(graphecreux *g,int *X,int *z1,int *z2)
+{
+int i;
+*z1 = 0;
+*z2 = 0;
+for(i = 0;i < g->nSize;i++)
+    {
+    *z1 += g->C1[X[i]];
+    *z2 += g->C2[X[i]];
+    }
+}
+
+/* --------------------------------------- phase 1 ------------------------------------------- */
+
+void resolutionRecursiveCreux(int z11,int z12,int z21,int z22,graphecreux *g,espacecreux *ws,listecreuse *L,int *X)
+{
+long long deltaZ1,deltaZ2,a,b;
+int z1,z2;
+
+if (VERBOSECREUX) printf("recherche entre (%d|%d) et (%d,%d)\n",z11,z12,z21,z22);
+deltaZ1 = abs(z21 - z11);
+deltaZ2 = abs(z22 - z12);
+
+combiConvexeCreux(deltaZ1,deltaZ2,g,ws->Cd);
+sapcreux(g,ws,X);
+computeValueCreux(g,X,&z1,&z2);
+if (isMemberCreux(z1,z2,L,0) == 0) insererListeCreuse(L,g->nSize,L->lgListe,X,z1,z2);
+
+a = deltaZ2 * z1 + deltaZ1 * z2;
+b = deltaZ2 * z21 + deltaZ1 * z22;
+
+if ( a != b )
+	{
+	resolutionRecursiveCreux(z11,z12,z1,z2,g,ws,L,X);
+	resolutionRecursiveCreux(z1,z2,z21,z22,g,ws,L,X);
+	}
+}
+
+/* --------------------------------------- phase 2 ------------------------------------------- */
+
+/* borne d'augmentation autorisee, d'apres les points nadirs locaux des solutions trouvees dans le triangle */
+
+void calculborneCreux(listecreuse *L,long long *borne,int r,int s,long long deltaZ1,long long deltaZ2,long long valinitCd,int taillePEinit)
+{
+int i;
+long long maxinter,maxtemp;
+
+maxinter = deltaZ2 * (L->z1[taillePEinit] - 1) + deltaZ1 * (L->z2[r] - 1);
+for(i = taillePEinit + 1;i < L->lgListe;i++)
+	{
+	maxtemp = deltaZ2 * (L->z1[i] - 1) + deltaZ1 * (L->z2[i - 1] - 1);
+	if (maxtemp > maxinter) maxinter = maxtemp;
+	}
+maxtemp = deltaZ2 * (L->z1[s] - 1) + deltaZ1 * (L->z2[L->lgListe - 1] - 1);
+if (maxtemp > maxinter) maxinter = maxtemp;
+
+maxinter = maxinter - valinitCd;
+if (maxinter < *borne) *borne = maxinter;
+}
+
+void TasCreuxDescend(tascreux **tab,int i,int tailletab)
+{
+int min;
+tascreux *temp;
+if ( (2 * i + 1 < tailletab) && (tab[2 * i + 1]->value < tab[i]->value) ) min = 2 * i + 1;
+else min = i;
+if ( (2 * i + 2 < tailletab) && (tab[2 * i + 2]->value < tab[min]->value) ) min = 2 * i + 2;
+
+if (min != i)
+    {
+    temp = tab[i]; tab[i] = tab[min]; tab[min] = temp;
+    TasCreuxDescend(tab,min,tailletab);
+    }
+}
+
+void TasCreuxMonte(tascreux **tab,int k)
+{
+tascreux *temp;
+while( (k > 0) && (tab[(k - 1) / 2]->value > tab[k]->value) )
+    {
+    temp = tab[k]; tab[k] = tab[(k - 1) / 2]; tab[(k - 1) / 2] = temp;
+    k = (k - 1) / 2;
+    }
+}
+
+/* plus court chemin alternant (label correcting) de la ligne i a la colonne cible dans le graphe residuel
+   de la solution X restreint aux lignes >= i, sans les colonnes imposees ni les arcs interdits */
+
+long long cheminCreux(graphecreux *g,espacecreux *ws,int *X,int i,int cible)
+{
+int n = g->nSize;
+int q,r,c,e,head = 0,size = 1;
+long long label,*dist = ws->dist;
+char *dansFile = ws->etat;
+
+dist[i] = 0;
+ws->touches[ws->nbTouches++] = i;
+ws->file[0] = i;
+dansFile[i] = 1;
+
+while(size > 0)
+    {
+    q = ws->file[head];
+    head = (head + 1) % (2 * n);
+    size--;
+    dansFile[q] = 0;
+    if (q < n)
+        {
+        /* ligne q : arcs admissibles vers les colonnes libres */
+        for(e = g->debut[q];e < g->debut[q + 1];e++)
+            {
+            c = g->colonne[e];
+            if ( (e == X[q]) || (ws->interdit[e] == 1) || (ws->fixe[c] == 1) ) continue;
+            label = dist[q] + ws->Cd[e];
+            if (label < dist[n + c])
+                {
+                if (dist[n + c] == INFINICREUX) ws->touches[ws->nbTouches++] = n + c;
+                dist[n + c] = label;
+                ws->predArc[c] = e;
+                if ( (c != cible) && (dansFile[n + c] == 0) )
+                    {
+                    ws->file[(head + size) % (2 * n)] = n + c;
+                    size++;
+                    dansFile[n + c] = 1;
+                    }
+                }
+            }
+        }
+    else
+        {
+        /* colonne q - n : arc inverse vers la ligne qui lui est affectee */
+        r = ws->ligneDe[q - n];
+        label = dist[q] - ws->Cd[X[r]];
+        if (label < dist[r])
+            {
+            if (dist[r] == INFINICREUX) ws->touches[ws->nbTouches++] = r;
+            dist[r] = label;
+            if (dansFile[r] == 0)
+                {
+                ws->file[(head + size) % (2 * n)] = r;
+                size++;
+                dansFile[r] = 1;
+                }
+            }
+        }
+    }
+return dist[n + cible];
+}
+
+/* calcule les fils d'un element du tas (partition de Murty) et les ajoute au tas s'ils respectent la borne */
+
+tascreux **ComputeNextSolutionCreux(graphecreux *g,espacecreux *ws,tascreux *pere,tascreux **tab,int *tailletab,int *taille,long long limite)
+{
+int n = g->nSize;
+int i,k,e,r,c,cible;
+long long pcc;
+tascreux *fils;
+
+for(k = 0;k < n;k++) ws->ligneDe[g->colonne[pere->X[k]]] = k;
+for(k = 0;k <= pere->DNI;k++) ws->fixe[g->colonne[pere->X[k]]] = 1;
+for(k = 0;k < pere->nbI;k++) ws->interdit[pere->I[k]] = 1;
+
+for(i = pere->DNI + 1;i < n - 1;i++)
+    {
+    if (i > pere->DNI + 1) ws->fixe[g->colonne[pere->X[i - 1]]] = 1;
+    cible = g->colonne[pere->X[i]];
+    ws->interdit[pere->X[i]] = 1;
+    pcc = cheminCreux(g,ws,pere->X,i,cible);
+    if ( (pcc != INFINICREUX) && (pere->value - ws->Cd[pere->X[i]] + pcc <= limite) )
+        {
+        fils = (tascreux *) malloc (sizeof(tascreux));
+        fils->X = (int *) malloc (n * sizeof(int));
+        for(k = 0;k < n;k++) fils->X[k] = pere->X[k];
+        c = cible;
+        do
+            {
+            e = ws->predArc[c];
+            r = g->ligne[e];
+            fils->X[r] = e;
+            c = g->colonne[pere->X[r]];
+            }
+        while(r != i);
+        fils->value = pere->value - ws->Cd[pere->X[i]] + pcc;
+        fils->DNI = i - 1;
+        fils->I = (int *) malloc ((pere->nbI + 1) * sizeof(int));
+        fils->nbI = 0;
+        for(k = 0;k < pere->nbI;k++) if (g->ligne[pere->I[k]] >= i) fils->I[(fils->nbI)++] = pere->I[k];
+        fils->I[(fils->nbI)++] = pere->X[i];
+        if (*tailletab == *taille)
+            {
+            (*taille) *= 2;
+            tab = (tascreux **) realloc (tab,(*taille) * sizeof(tascreux *));
+            }
+        tab[(*tailletab)++] = fils;
+        TasCreuxMonte(tab,(*tailletab) - 1);
+        }
+    reinitLabels(ws);
+    }
+
+for(k = 0;k < n;k++) ws->fixe[k] = 0;
+for(k = 0;k < pere->nbI;k++) ws->interdit[pere->I[k]] = 0;
+for(i = pere->DNI + 1;i < n - 1;i++) ws->interdit[pere->X[i]] = 0;
+return tab;
+}
+
+void rankingCreux(graphecreux *g,espacecreux *ws,listecreuse *L,int r,int s)
+{
+int n = g->nSize;
+int k,z1,z2;
+int taillePEinit = L->lgListe;
+long long deltaZ1 = L->z1[s] - L->z1[r],deltaZ2 = L->z2[r] - L->z2[s];
+long long borne = deltaZ1 * deltaZ2 - deltaZ1 - deltaZ2;
+long long valinitCd = deltaZ2 * L->z1[r] + deltaZ1 * L->z2[r];
+int tailletab = 1,taille = 1024;
+tascreux **tab,*courant;
+
+if (VERBOSECREUX) printf("recherche dans le triangle defini par (%d,%d) et (%d,%d)\n",L->z1[r],L->z2[r],L->z1[s],L->z2[s]);
+if (borne < 0) return;
+
+combiConvexeCreux(deltaZ1,deltaZ2,g,ws->Cd);
+
+tab = (tascreux **) malloc (taille * sizeof(tascreux *));
+tab[0] = (tascreux *) malloc (sizeof(tascreux));
+tab[0]->X = (int *) malloc (n * sizeof(int));
+tab[0]->DNI = - 1;
+tab[0]->I = NULL;
+tab[0]->nbI = 0;
+sapcreux(g,ws,tab[0]->X);
+tab[0]->value = 0;
+for(k = 0;k < n;k++) tab[0]->value += ws->Cd[tab[0]->X[k]];
+
+while( (tailletab > 0) && (tab[0]->value - valinitCd <= borne) )
+    {
+    courant = tab[0];
+    tab[0] = tab[--tailletab];
+    TasCreuxDescend(tab,0,tailletab);
+
+    computeValueCreux(g,courant->X,&z1,&z2);
+    if ( (z1 < L->z1[s]) && (z2 < L->z2[r])
+         && (estdomineeCreux(z1,z2,L,taillePEinit) == 0) && (isMemberCreux(z1,z2,L,taillePEinit) == 0) )
+        {
+        /* les solutions du triangle restent triees suivant z1 */
+        k = L->lgListe;
+        while( (k > taillePEinit) && (L->z1[k - 1] > z1) ) k--;
+        insererListeCreuse(L,n,k,courant->X,z1,z2);
+        calculborneCreux(L,&borne,r,s,deltaZ1,deltaZ2,valinitCd,taillePEinit);
+        }
+
+    tab = ComputeNextSolutionCreux(g,ws,courant,tab,&tailletab,&taille,valinitCd + borne);
+    free(courant->X);
+    free(courant->I);
+    free(courant);
+    }
+
+for(k = 0;k < tailletab;k++)
+    {
+    free(tab[k]->X);
+    free(tab[k]->I);
+    free(tab[k]);
+    }
+free(tab);
+}
+
+/* ------------------------------------------ main ------------------------------------------- */
+
+void solve_bilap_sparse(int nSize, int *debut, int *colonne, int *c1, int *c2, int **z1, int **z2, int **solutions, int *nbsolutions)
+{
+int i,j,k,lg,za,zb;
+graphecreux g;
+espacecreux *ws;
+listecreuse L;
+int *X = (int *) malloc (nSize * sizeof(int));
+
+g.nSize = nSize;
+g.nbArcs = debut[nSize];
+g.debut = debut;
+g.colonne = colonne;
+g.C1 = c1;
+g.C2 = c2;
+ws = creerEspaceCreux(&g);
+initListeCreuse(&L,nSize);
+
+/* ---- Solutions lexicographiques -------------------------------- */
+
+combiConvexeCreux(0,1,&g,ws->Cd);
+if (sapcreux(&g,ws,X) == 0)
+    {
+    puts("pas d'affectation complete");
+    L.lgListe = 0;
+    }
+else
+    {
+    computeValueCreux(&g,X,&za,&zb);
+    combiConvexeCreux(1,(long long) zb + 1,&g,ws->Cd);
+    sapcreux(&g,ws,X);
+    computeValueCreux(&g,X,&za,&zb);
+    insererListeCreuse(&L,nSize,L.lgListe,X,za,zb);
+
+    combiConvexeCreux(1,0,&g,ws->Cd);
+    sapcreux(&g,ws,X);
+    computeValueCreux(&g,X,&za,&zb);
+    combiConvexeCreux((long long) za + 1,1,&g,ws->Cd);
+    sapcreux(&g,ws,X);
+    computeValueCreux(&g,X,&za,&zb);
+    insererListeCreuse(&L,nSize,L.lgListe,X,za,zb);
+
+    if (L.z1[0] == L.z1[1]) L.lgListe = 1;
+    else
+        {
+        /* ---- phase 1 ---- */
+
+        resolutionRecursiveCreux(L.z1[0],L.z2[0],L.z1[1],L.z2[1],&g,ws,&L,X);
+        lg = L.lgListe;
+        trierListeCreuse(&L,nSize,0);
+
+        /* ---- phase 2, les triangles sont parcourus suivant z1 croissant ---- */
+
+        for(k = 0;k < lg - 1;k++) if (L.z1[k] != L.z1[k + 1]) rankingCreux(&g,ws,&L,k,k + 1);
+        }
+    }
+
+   *z1 = calloc(L.lgListe, sizeof(int));
+   *z2 = calloc(L.lgListe, sizeof(int));
+   *solutions = calloc(L.lgListe * nSize, sizeof(int));
+   *nbsolutions = L.lgListe;
+
+   for (i = 0; i < L.lgListe ; i++){
+	   (*z1)[i] = L.z1[i];
+	   (*z2)[i] = L.z2[i];
+	   for(j = 0; j < nSize; j++){
+	     (*solutions)[i*nSize + j] = colonne[L.X[i*nSize + j]];
+	   }
+	}
+
+libererListeCreuse(&L);
+libererEspaceCreux(&g,ws);
+free(X);
+}
+
+/* EOF */
@@ -0,0 +1,117 @@
+/*!
+* \file 2phcreux.h
+* \brief Solver bi-objective LAP creux (seules les affectations admissibles sont donnees)
+*
+*/
+
+#ifndef PHCREUX_H
+#define PHCREUX_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <limits.h>
+
+#define INFINICREUX (LLONG_MAX / 4) /* infini pour les couts ponderes */
+#define VERBOSECREUX 0 /* baratin */
+
+/* -----------------------   definition des structures ------------------------------------------------ */
+
+/** \typedef graphe biparti creux au format CSR : les arcs admissibles de la ligne i sont les arcs
+    debut[i] a debut[i + 1] - 1, l'arc e va dans la colonne colonne[e] et coute (C1[e],C2[e]) */
+
+typedef struct
+{
+int nSize;
+int nbArcs;
+int *debut;
+int *colonne;
+int *C1;
+int *C2;
+int *ligne; // ligne de chaque arc (calcule)
+} graphecreux;
+
+/** \typedef liste extensible de solutions, une solution est donnee par l'arc affecte a chaque ligne */
+
+typedef struct
+{
+int *X; // lgListe * nSize arcs
+int *z1;
+int *z2;
+int lgListe;
+int taille; // taille allouee
+} listecreuse;
+
+/** \typedef element du tas du ranking */
+
+typedef struct
+{
+int *X; // arc affecte a chaque ligne
+long long value; // valeur pour la ponderation des objectifs
+int DNI; // derniere ligne imposee pour obtenir cette solution
+int *I; // arcs interdits pour obtenir cette solution
+int nbI;
+} tascreux;
+
+/** \typedef tableaux de travail de taille nSize ou nbArcs, alloues une fois par resolution */
+
+typedef struct
+{
+long long *Cd; // cout pondere de chaque arc
+long long *u; // variables duales des lignes
+long long *v; // variables duales des colonnes
+long long *dist; // labels (colonnes pour le SAP, lignes puis colonnes pour le label correcting)
+int *predArc; // arc par lequel chaque colonne est atteinte
+int *ligneDe; // ligne affectee a chaque colonne
+char *etat; // 0 : non atteint, 1 : atteint, 2 : definitif (SAP) / dans la file (label correcting)
+int *touches; // noeuds dont le label a ete modifie, pour la reinitialisation
+int nbTouches;
+long long *tasValeur; // tas binaire de Dijkstra (avec doublons)
+int *tasNoeud;
+int tailleTas;
+int *vus; // colonnes rendues definitives par Dijkstra
+int *file; // file du label correcting
+char *fixe; // colonnes imposees
+char *interdit; // arcs interdits
+} espacecreux;
+
+/** \brief affectation de cout pondere (ws->Cd) minimal par plus courts chemins augmentants, retourne 0
+  * s'il n'existe pas d'affectation complete utilisant les arcs admissibles
+  *
+  * \fn int sapcreux(graphecreux *g,espacecreux *ws,int *X)
+  * \param graphecreux *g
+  * \param espacecreux *ws
+  * \param int *X arc affecte a chaque ligne
+  * \retval int
+  */
+int sapcreux(graphecreux *,espacecreux *,int *);
+
+/** \brief calcule la matrice ponderee deltaZ2 * C1 + deltaZ1 * C2 sur les arcs admissibles
+  *
+  * \fn void combiConvexeCreux(long long deltaZ1,long long deltaZ2,graphecreux *g,long long *Cd)
+  * \retval void
+  */
+void combiConvexeCreux(long long ,long long ,graphecreux *,long long *);
+
+/** \brief recherche des solutions supportees entre deux solutions, comme resolutionRecursive
+  *
+  * \fn void resolutionRecursiveCreux(int z11,int z12,int z21,int z22,graphecreux *g,espacecreux *ws,listecreuse *L,int *X)
+  * \retval void
+  */
+void resolutionRecursiveCreux(int ,int ,int ,int ,graphecreux *,espacecreux *,listecreuse *,int *);
+
+/** \brief ranking dans le triangle defini par les solutions supportees r et s (indices dans L),
+  * les solutions trouvees sont ajoutees a L
+  *
+  * \fn void rankingCreux(graphecreux *g,espacecreux *ws,listecreuse *L,int r,int s)
+  * \retval void
+  */
+void rankingCreux(graphecreux *,espacecreux *,listecreuse *,int ,int );
+
+/* \brief main, version creuse de solve_bilap_exact
+ * \fn solve_bilap_sparse()
+ *
+ * les arcs admissibles de la ligne i sont debut[i] a debut[i + 1] - 1 (debut est de taille nSize + 1),
+ * nbsolutions vaut 0 s'il n'existe pas d'affectation complete
+ */
+void solve_bilap_sparse(int nSize, int *debut, int *colonne, int *c1, int *c2, int **z1, int **z2, int **solutions, int *nbsolutions);
+#endif
@@ -663,7 +663,7 @@ solution s;
 
 /* calcule des coefficients de l'agregation */
 
-printf("recherche entre (%d|%d) et (%d,%d)\n",z11,z12,z21,z22);
+if (VERBOSE) printf("recherche entre (%d|%d) et (%d,%d)\n",z11,z12,z21,z22);
 deltaZ1 = abs(z21 - z11);
 deltaZ2 = abs(z22 - z12);//printf("a1 = %d et a2 = %d\n",deltaZ2,deltaZ1);
 
@@ -690,6 +690,183 @@ if ( a != b )
 	}
 }
 
+void reoptimiser(int Cd[SizeMax][SizeMax],short int nSize,etatDual *e,int chaud)
+{
+int i,j,k,r,s,puits,nbvus;
+int dmin = 0,nd;
+int dist[SizeMax];
+short int pred[SizeMax],fait[SizeMax],vus[SizeMax];
+
+/* duales realisables : v[j] = min sur i de Cd[i][j] - u[i] */
+
+if (chaud == 0)
+    for(i = 0;i < nSize;i++)
+        {
+        e->u[i] = 0;
+        e->x[i] = - 1;
+        e->y[i] = - 1;
+        }
+for(j = 0;j < nSize;j++)
+    {
+    e->v[j] = Cd[0][j] - e->u[0];
+    for(i = 1;i < nSize;i++) if (Cd[i][j] - e->u[i] < e->v[j]) e->v[j] = Cd[i][j] - e->u[i];
+    }
+
+/* les affectations qui ne sont plus serrees sont liberees */
+
+for(i = 0;i < nSize;i++)
+    if ( (e->x[i] != - 1) && (Cd[i][e->x[i]] - e->u[i] - e->v[e->x[i]] != 0) )
+        {
+        e->y[e->x[i]] = - 1;
+        e->x[i] = - 1;
+        }
+
+/* reaffectation des lignes libres par plus courts chemins en couts reduits */
+
+for(s = 0;s < nSize;s++)
+    {
+    if (e->x[s] != - 1) continue;
+    for(j = 0;j < nSize;j++)
+        {
+        dist[j] = Cd[s][j] - e->u[s] - e->v[j];
+        pred[j] = s;
+        fait[j] = 0;
+        }
+    nbvus = 0;
+    puits = - 1;
+    while(puits == - 1)
+        {
+        j = - 1;
+        for(k = 0;k < nSize;k++) if ( (fait[k] == 0) && ( (j == - 1) || (dist[k] < dist[j]) ) ) j = k;
+        fait[j] = 1;
+        if (e->y[j] == - 1)
+            {
+            puits = j;
+            dmin = dist[j];
+            }
+        else
+            {
+            vus[nbvus++] = j;
+            r = e->y[j];
+            for(k = 0;k < nSize;k++)
+                if (fait[k] == 0)
+                    {
+                    nd = dist[j] + Cd[r][k] - e->u[r] - e->v[k];
+                    if (nd < dist[k])
+                        {
+                        dist[k] = nd;
+                        pred[k] = r;
+                        }
+                    }
+            }
+        }
+
+    /* mise a jour des duales, puis augmentation le long du chemin */
+
+    e->u[s] += dmin;
+    for(k = 0;k < nbvus;k++)
+        {
+        j = vus[k];
+        e->u[e->y[j]] += dmin - dist[j];
+        e->v[j] -= dmin - dist[j];
+        }
+    j = puits;
+    do
+        {
+        r = pred[j];
+        k = e->x[r];
+        e->x[r] = j;
+        e->y[j] = r;
+        j = k;
+        }
+    while(r != s);
+    }
+}
+
+void resolutionIterative(int z11,int z12,int z21,int z22,short int nSize,int C1[SizeMax][SizeMax],
+                         int C2[SizeMax][SizeMax],listeSol *listeS,etatDual *depart)
+{
+int i,k,nbcourants = 1,nbsuivants,a,b;
+segment *courants = (segment *) malloc (sizeof(segment));
+segment *suivants;
+solution *sols;
+etatDual **etats,**anciens = NULL;
+int nbanciens = 0;
+
+courants[0].z11 = z11;
+courants[0].z12 = z12;
+courants[0].z21 = z21;
+courants[0].z22 = z22;
+courants[0].depart = depart;
+
+/* une vague traite tous les segments en attente, chaque segment pouvant en produire deux pour la vague suivante */
+
+while(nbcourants > 0)
+    {
+    sols = (solution *) malloc (nbcourants * sizeof(solution));
+    etats = (etatDual **) malloc (nbcourants * sizeof(etatDual *));
+
+    #pragma omp parallel for schedule(dynamic) private(i)
+    for(k = 0;k < nbcourants;k++)
+        {
+        int (*Cd)[SizeMax] = malloc (SizeMax * sizeof(*Cd));
+        segment *g = &(courants[k]);
+
+        if (VERBOSE) printf("recherche entre (%d|%d) et (%d,%d)\n",g->z11,g->z12,g->z21,g->z22);
+        etats[k] = (etatDual *) malloc (sizeof(etatDual));
+        if (g->depart != NULL) *(etats[k]) = *(g->depart);
+        combiConvexe(abs(g->z21 - g->z11),abs(g->z22 - g->z12),nSize,Cd,C1,C2);
+        reoptimiser(Cd,nSize,etats[k],g->depart != NULL);
+        for(i = 0;i < nSize;i++) sols[k].X[i] = etats[k]->x[i];
+        computeValue(&(sols[k]),C1,C2,nSize);
+        free(Cd);
+        }
+
+    /* mise a jour de la liste et des segments en attente, dans l'ordre des segments */
+
+    suivants = (segment *) malloc (2 * nbcourants * sizeof(segment));
+    nbsuivants = 0;
+    for(k = 0;k < nbcourants;k++)
+        {
+        segment *g = &(courants[k]);
+        if (isMember(&(sols[k]),listeS) == 0) addList(nSize,&(sols[k]),listeS);
+        a = abs(g->z22 - g->z12) * sols[k].z[0] + abs(g->z21 - g->z11) * sols[k].z[1];
+        b = abs(g->z22 - g->z12) * g->z21 + abs(g->z21 - g->z11) * g->z22;
+        if (a != b)
+            {
+            suivants[nbsuivants].z11 = g->z11;
+            suivants[nbsuivants].z12 = g->z12;
+            suivants[nbsuivants].z21 = sols[k].z[0];
+            suivants[nbsuivants].z22 = sols[k].z[1];
+            suivants[nbsuivants].depart = etats[k];
+            nbsuivants++;
+            suivants[nbsuivants].z11 = sols[k].z[0];
+            suivants[nbsuivants].z12 = sols[k].z[1];
+            suivants[nbsuivants].z21 = g->z21;
+            suivants[nbsuivants].z22 = g->z22;
+            suivants[nbsuivants].depart = etats[k];
+            nbsuivants++;
+            }
+        }
+
+    /* les etats de la vague precedente ne servent plus */
+
+    for(k = 0;k < nbanciens;k++) free(anciens[k]);
+    free(anciens);
+    anciens = etats;
+    nbanciens = nbcourants;
+
+    free(sols);
+    free(courants);
+    courants = suivants;
+    nbcourants = nbsuivants;
+    }
+
+for(k = 0;k < nbanciens;k++) free(anciens[k]);
+free(anciens);
+free(courants);
+}
+
 void loadInstance(int n, int C1[SizeMax][SizeMax], int C2[SizeMax][SizeMax], donnees  * uneInstance)
 {
    int i,j;
@@ -842,14 +1019,11 @@ t[j] = temp;
 
 /** \brief lance la phase 2 dans un triangle defini par deux solutions supportees et remplit la listeSol listePE
   *
-  * \fn void lancerLesTest(short int nSize,int C1[SizeMax][SizeMax],int C2[SizeMax][SizeMax],
-                    solution r,solution s,listeSol *listePE,int premier,int dernier)
+  * \fn void lancerLesTest(short int nSize,espaceTravail *ws,solution *r,solution *s,int premier,int dernier)
   * \param short int nSize
-  * \param int C1[SizeMax][SizeMax]
-  * \param int C2[SizeMax][SizeMax]
-  * \param solution r
-  * \param solution s
-  * \param listeSol *listePE
+  * \param espaceTravail *ws
+  * \param solution *r
+  * \param solution *s
   * \param int premier
   * \param int dernier
   * \retval void
@@ -1083,7 +1257,7 @@ if (DNIinit < nSize - 3) // si on a moins de n - 2 variables fixees ==> on a qqc
         for(j = 0;j < taillegraphe - 2;j = j + 2)
             {
             temp.u = graphe[j].num;
-            if (applistarc(temp,Iloc) == 0)
+            if ( (C[temp.u][temp.v] <= (*borne)) && (applistarc(temp,Iloc) == 0) )
                 {
                 (graphe[j].suiv)[(graphe[j].nbsuiv)] = graphe[taillegraphe - 1].num;
                 (graphe[j].cout)[(graphe[j].nbsuiv)] = C[temp.u][temp.v];
@@ -1096,7 +1270,7 @@ if (DNIinit < nSize - 3) // si on a moins de n - 2 variables fixees ==> on a qqc
         for(j = 1;j < taillegraphe - 1;j = j + 2)
             {
             temp.v = graphe[j].num - nSize;
-            if (applistarc(temp,Iloc) == 0)
+            if ( (C[temp.u][temp.v] <= (*borne)) && (applistarc(temp,Iloc) == 0) )
                 {
                 (graphe[taillegraphe - 2].suiv)[(graphe[taillegraphe - 2].nbsuiv)] = graphe[j].num;
                 (graphe[taillegraphe - 2].cout)[(graphe[taillegraphe - 2].nbsuiv)] = C[temp.u][temp.v];
@@ -1221,7 +1395,7 @@ if (DNIinit < nSize - 3) // si on a moins de n - 2 variables fixees ==> on a qqc
     for(j = 0;j < taillegraphe - 2;j = j + 2)
         {
         temp.u = graphe[j].num;
-        if (applistarc(temp,Ilocinit) == 0)
+        if ( (C[temp.u][temp.v] <= (*borne)) && (applistarc(temp,Ilocinit) == 0) )
             {
             (graphe[j].suiv)[(graphe[j].nbsuiv)] = graphe[taillegraphe - 1].num;
             (graphe[j].cout)[(graphe[j].nbsuiv)] = C[temp.u][temp.v];
@@ -1234,7 +1408,7 @@ if (DNIinit < nSize - 3) // si on a moins de n - 2 variables fixees ==> on a qqc
     for(j = 1;j < taillegraphe - 1;j = j + 2)
         {
         temp.v = graphe[j].num - nSize;
-        if (applistarc(temp,Ilocinit) == 0)
+        if ( (C[temp.u][temp.v] <= (*borne)) && (applistarc(temp,Ilocinit) == 0) )
             {
             (graphe[taillegraphe - 2].suiv)[(graphe[taillegraphe - 2].nbsuiv)] = graphe[j].num;
             (graphe[taillegraphe - 2].cout)[(graphe[taillegraphe - 2].nbsuiv)] = C[temp.u][temp.v];
@@ -1287,7 +1461,7 @@ return tab;
 }
 
 void ranking(int C1[SizeMax][SizeMax],int C2[SizeMax][SizeMax],int Cd[SizeMax][SizeMax],int *borne,short int nSize,solution *r,solution *s,
-             listeSol *listePE)
+             listeSol *listePE,tas **ptab,int *taille)
 {
 /* Cb est une matrice de couts reduits recuperee apres l'appel a la methode hongroise
    deltaZ1 et deltaZ2 sont les largeurs et hauteurs du triangle
@@ -1299,16 +1473,17 @@ int taillePEinit = listePE->lgListe;
 int min,valinitCd = 0;
 int deltaZ1 = s->z[0] - r->z[0],deltaZ2 = r->z[1] - s->z[1];// taille des cotes du triangle
 
-/* calcul de valinitCd */
-
-for(i = 0;i < nSize;i++) valinitCd += Cd[i][r->X[i]];
-
 /* interdiction des affectations supprimes lors de tests */
 
-tas *tab;
+/* le tas est celui de l'espace de travail, il n'est alloue qu'au premier ranking */
+
+tas *tab = *ptab;
 int tailletab = 1;
-int taille = 10000;
-tab = (tas *) malloc ( taille * sizeof (tas) );
+if (tab == NULL)
+    {
+    *taille = 10000;
+    tab = (tas *) malloc ( (*taille) * sizeof (tas) );
+    }
 
 tab[0].I = NULL;
 tab[0].DNI = -1;
@@ -1317,6 +1492,12 @@ tab[0].s = (solution *) malloc (sizeof(solution));
 
 hung(Cd,nSize,tab[0].s,Cb);
 
+/* calcul de valinitCd, valeur de l'optimum de Cd. Si des arcs ont ete interdits dans Cd (reductionTriangle),
+   l'optimum peut etre au dessus de la droite (r,s) : la borne est diminuee d'autant */
+
+for(i = 0;i < nSize;i++) valinitCd += Cd[i][(tab[0].s)->X[i]];
+*borne -= valinitCd - (deltaZ2 * r->z[0] + deltaZ1 * r->z[1]);
+
 //puts("matrice initiale");
 //for(i = 0;i < nSize;i++)
 //    {for(j = 0;j < nSize;j++) printf("%8d ",Cb[i][j]);puts("");}
@@ -1344,26 +1525,25 @@ while(min <= *borne)
             }
         //else addList(nSize,tab[0].s,listePE);
         }
-    tab = ComputeNextSolution(tab,&tailletab,&taille,Cb,C1,C2,nSize,borne);
+    tab = ComputeNextSolution(tab,&tailletab,taille,Cb,C1,C2,nSize,borne);
     if (tailletab != 0) min = tab[0].value;//printf("min = %d et borne = %d\n",min,(*borne));
     else min = (*borne) + 1;
     //showSolution(0, nSize, tab[0].s);
     }    
 
-//liberation de la memoire
+//liberation de la memoire, le tas lui-meme est conserve pour le prochain ranking
 for(i = 0;i < tailletab;i++)
     {
     tab[i].I = supprimerliste(tab[i].I);
     free(tab[i].s);
     }
-free(tab);
+*ptab = tab;
 //printf("tailletab = %d\n",tailletab);
 }
 
-void lancerLesTest(short int nSize,int C1[SizeMax][SizeMax],int C2[SizeMax][SizeMax],
-                    solution *r,solution *s,listeSol *listePE,int premier,int dernier)
+void lancerLesTest(short int nSize,espaceTravail *ws,solution *r,solution *s,int premier,int dernier)
 {
-printf("recherche dans le triangle defini par (%d,%d) et (%d,%d)\n",r->z[0],r->z[1],s->z[0],s->z[1]);
+if (VERBOSE) printf("recherche dans le triangle defini par (%d,%d) et (%d,%d)\n",r->z[0],r->z[1],s->z[0],s->z[1]);
 
 /* deltaZ1 est le la largeur du triangle, deltaZ2 est la hauteur, borne est la limite qu'il est inutile de depasser */
 
@@ -1374,150 +1554,289 @@ int borne = deltaZ1 * deltaZ2 - deltaZ1 - deltaZ2;
 
 if (borne >=0)
     {
-    int Cd[SizeMax][SizeMax];
-    combiConvexe(deltaZ1,deltaZ2,nSize,Cd,C1,C2);
-    ranking(C1,C2,Cd,&borne,nSize,r,s,listePE);
+    combiConvexe(deltaZ1,deltaZ2,nSize,ws->Cd,ws->C1,ws->C2);
+    if (reductionTriangle(ws,nSize,r,s,borne) == 1)
+        ranking(ws->C1,ws->C2,ws->Cd,&borne,nSize,r,s,&(ws->listePE),&(ws->tab),&(ws->taille));
     }
 }
 
-void solve_bilap_exact(int *c1, int *c2, int nSize, int **z1, int **z2, int **solutions, int* nbsolutions)
+int reductionTriangle(espaceTravail *ws,short int nSize,solution *r,solution *s,int borne)
+{
+int i,j,k,nb,dernier,modif,minCd = 0;
+long long deltaZ1 = s->z[0] - r->z[0],deltaZ2 = r->z[1] - s->z[1];
+long long limite = deltaZ2 * r->z[0] + deltaZ1 * r->z[1] + borne;// valeur maximale de Cd dans le triangle
+long long base = deltaZ2 * ws->z1min + deltaZ1 * ws->z2min;
+long long grand;
+char interdit[SizeMax][SizeMax];
+
+/* une solution du triangle verifie z1 <= s.z1 - 1, z2 <= r.z2 - 1 et Cd <= limite : un arc qui force
+   l'une de ces bornes a etre depassee, d'apres les couts reduits des deux objectifs, est interdit */
+
+for(i = 0;i < nSize;i++)
+    for(j = 0;j < nSize;j++)
+        {
+        interdit[i][j] = (ws->z1min + ws->Cb1[i][j] > s->z[0] - 1)
+                      || (ws->z2min + ws->Cb2[i][j] > r->z[1] - 1)
+                      || (base + deltaZ2 * ws->Cb1[i][j] + deltaZ1 * ws->Cb2[i][j] > limite);
+        if (ws->Cd[i][j] < minCd) minCd = ws->Cd[i][j];
+        }
+
+/* propagation : une ligne (ou colonne) qui n'a plus qu'un arc autorise le fixe, ce qui interdit
+   les autres arcs de sa colonne (ou ligne) */
+
+do
+    {
+    modif = 0;
+    for(i = 0;i < nSize;i++)
+        {
+        nb = 0;
+        dernier = - 1;
+        for(j = 0;j < nSize;j++) if (interdit[i][j] == 0) {nb++;dernier = j;}
+        if (nb == 0) return 0;
+        if (nb == 1)
+            for(k = 0;k < nSize;k++)
+                if ( (k != i) && (interdit[k][dernier] == 0) ) {interdit[k][dernier] = 1;modif = 1;}
+        }
+    for(j = 0;j < nSize;j++)
+        {
+        nb = 0;
+        dernier = - 1;
+        for(i = 0;i < nSize;i++) if (interdit[i][j] == 0) {nb++;dernier = i;}
+        if (nb == 0) return 0;
+        if (nb == 1)
+            for(k = 0;k < nSize;k++)
+                if ( (k != j) && (interdit[dernier][k] == 0) ) {interdit[dernier][k] = 1;modif = 1;}
+        }
+    }
+while(modif == 1);
+
+/* les arcs interdits recoivent un cout tel que toute solution qui en utilise un depasse la limite,
+   sauf si ce cout risque de deborder : le ranking se fait alors sur le probleme complet */
+
+grand = limite + 1 - (long long) nSize * minCd;
+if (grand * nSize * 2 >= INFINI * 100) return 1;
+for(i = 0;i < nSize;i++)
+    for(j = 0;j < nSize;j++)
+        if (interdit[i][j] == 1) ws->Cd[i][j] = (int) grand;
+return 1;
+}
+
+espaceTravail *creerEspaceTravail()
+{
+espaceTravail *ws = (espaceTravail *) malloc (sizeof(espaceTravail));
+ws->listePE.lgListe = 0;
+ws->lgSE = 0;
+ws->tab = NULL;
+ws->taille = 0;
+return ws;
+}
+
+void libererEspaceTravail(espaceTravail *ws)
+{
+free(ws->tab);
+free(ws);
+}
+
+void resoudreInstance(espaceTravail *ws,int *c1,int *c2,short int nSize)
 {
 int i,j,k,lg;
-int C1[SizeMax][SizeMax],C2[SizeMax][SizeMax],Cd[SizeMax][SizeMax];
 solution s;
-int Ctemp[SizeMax][SizeMax];
-listeSol listePE;
+listeSol *listePE = &(ws->listePE);
 
 
 /* Initialisation ------------------------------------------------- */
 
   for(i = 0;i < nSize;i++)
-  	for(j = 0;j < nSize;j++) C1[i][j] = c1[i*nSize + j];
+  	for(j = 0;j < nSize;j++) ws->C1[i][j] = c1[i*nSize + j];
   for(i = 0;i < nSize;i++)
-  	for(j = 0;j < nSize;j++) C2[i][j] = c2[i*nSize + j];
-  listePE.lgListe    = 0;
+  	for(j = 0;j < nSize;j++) ws->C2[i][j] = c2[i*nSize + j];
+  listePE->lgListe    = 0;
 
 /* ---- CALCUL DES SE --------------------------------------------- */
 
   /* ---- Recherche efficace sur z1 --------------------------------- */
-  printf("\n OK \n");
-  hung(C1,nSize,&s,Ctemp);
+  hung(ws->C1,nSize,&s,ws->Cb1);
   
+  ws->z1min = 0;
+  for(i = 0;i < nSize;i++) ws->z1min += ws->C1[i][s.X[i]];
   s.z[1] = 0;
-  for(i = 0;i < nSize;i++) s.z[1] += C2[i][s.X[i]];
+  for(i = 0;i < nSize;i++) s.z[1] += ws->C2[i][s.X[i]];
     
-  combiConvexe(1,s.z[1] + 1,nSize,Cd,C1,C2);
+  combiConvexe(1,s.z[1] + 1,nSize,ws->Cd,ws->C1,ws->C2);
 
-  hung(Cd,nSize,&s,Ctemp);
+  hung(ws->Cd,nSize,&s,ws->Ctemp);
     
-  addList(nSize,&s,&listePE);
+  addList(nSize,&s,listePE);
   
   /* ---- Recherche efficace sur z2 --------------------------------- */
 
-  hung(C2,nSize,&s,Ctemp);
+  hung(ws->C2,nSize,&s,ws->Cb2);
   
+  ws->z2min = 0;
+  for(i = 0;i < nSize;i++) ws->z2min += ws->C2[i][s.X[i]];
   s.z[0] = 0;
-  for(i = 0;i < nSize;i++) s.z[0] += C1[i][s.X[i]];
+  for(i = 0;i < nSize;i++) s.z[0] += ws->C1[i][s.X[i]];
   
-  combiConvexe(s.z[0] + 1,1,nSize,Cd,C1,C2);
+  combiConvexe(s.z[0] + 1,1,nSize,ws->Cd,ws->C1,ws->C2);
   
-  hung(Cd,nSize,&s,Ctemp);
+  hung(ws->Cd,nSize,&s,ws->Ctemp);
   
-  addList(nSize,&s,&listePE);
+  addList(nSize,&s,listePE);
 
   for(i = 0;i < 2;i++)
   	{
-	listePE.liste[i].z[0] = 0;
-	listePE.liste[i].z[1] = 0;
+	listePE->liste[i].z[0] = 0;
+	listePE->liste[i].z[1] = 0;
 	}
 
   for(i = 0;i < 2;i++)
   	for(j = 0;j < nSize;j++)
 		{
-		listePE.liste[i].z[0] += C1[j][listePE.liste[i].X[j]];
-		listePE.liste[i].z[1] += C2[j][listePE.liste[i].X[j]];
+		listePE->liste[i].z[0] += ws->C1[j][listePE->liste[i].X[j]];
+		listePE->liste[i].z[1] += ws->C2[j][listePE->liste[i].X[j]];
 		}
 
-  if (listePE.liste[0].z[0] == listePE.liste[1].z[0]) 
+  /* solution ideale : le front est reduit a un point */
+
+  if (listePE->liste[0].z[0] == listePE->liste[1].z[0]) 
 	{
-	puts("solution ideale");
-	exit(0);
+	if (VERBOSE) puts("solution ideale");
+	listePE->lgListe = 1;
+	ws->lgSE = 1;
+	return;
 	}
 
 
   /* ---- Resolution dichotomique ----------------------------------- */
      
-     printf(" \n Calculs en cours... \n");
-     puts("phase 1");
+     if (VERBOSE) puts("phase 1");
 
-     resolutionRecursive(listePE.liste[0].z[0],listePE.liste[0].z[1],listePE.liste[listePE.lgListe - 1].z[0],
-                         listePE.liste[listePE.lgListe - 1].z[1],nSize,C1,C2,
-                         &listePE);
+     resolutionIterative(listePE->liste[0].z[0],listePE->liste[0].z[1],listePE->liste[listePE->lgListe - 1].z[0],
+                         listePE->liste[listePE->lgListe - 1].z[1],nSize,ws->C1,ws->C2,
+                         listePE,NULL);
 
   /* nombre de solutions supportees */
 
-     lg = listePE.lgListe;
+     lg = listePE->lgListe;
+     ws->lgSE = lg;
 
   /* tri de ces solutions suivant Z[0] */
 
-     sortApproximation1(&(listePE.liste[0]),lg);
+     sortApproximation1(&(listePE->liste[0]),lg);
 
   /* lancement de la phase 2 */
 
-     puts("phase 2");
+     if (VERBOSE) puts("phase 2");
 
      j = 0;
-     while(listePE.liste[j].z[0] == listePE.liste[j + 1].z[0]) j++;
+     while(listePE->liste[j].z[0] == listePE->liste[j + 1].z[0]) j++;
 
      i = lg - 2;
-     while(listePE.liste[i].z[0] == listePE.liste[i + 1].z[0]) i--;
+     while(listePE->liste[i].z[0] == listePE->liste[i + 1].z[0]) i--;
 
-     if (i == j) lancerLesTest(nSize,C1,C2,&(listePE.liste[j]),&(listePE.liste[j + 1]),
-                               &listePE,1,1);
+     if (i == j) lancerLesTest(nSize,ws,&(listePE->liste[j]),&(listePE->liste[j + 1]),1,1);
           else
 	  {
-          lancerLesTest(nSize,C1,C2,&(listePE.liste[j]),&(listePE.liste[j + 1]),&listePE,1,0);
-          lancerLesTest(nSize,C1,C2,&(listePE.liste[i]),&(listePE.liste[i + 1]),&listePE,0,1);
-	  for(k = j + 1;k < i;k++) if (listePE.liste[k].z[0] != listePE.liste[k + 1].z[0]) lancerLesTest(nSize,C1,C2,&(listePE.liste[k]),&(listePE.liste[k + 1]),&listePE,0,0);
+          lancerLesTest(nSize,ws,&(listePE->liste[j]),&(listePE->liste[j + 1]),1,0);
+          lancerLesTest(nSize,ws,&(listePE->liste[i]),&(listePE->liste[i + 1]),0,1);
+	  for(k = j + 1;k < i;k++) if (listePE->liste[k].z[0] != listePE->liste[k + 1].z[0]) lancerLesTest(nSize,ws,&(listePE->liste[k]),&(listePE->liste[k + 1]),0,0);
            }
 
+     sortApproximation1(&(listePE->liste[lg]),listePE->lgListe - lg);
+}
+
+void solve_bilap_exact(int *c1, int *c2, int nSize, int **z1, int **z2, int **solutions, int* nbsolutions)
+{
+int i,j,lg;
+espaceTravail *ws = creerEspaceTravail();
+listeSol *listePE = &(ws->listePE);
+
+  printf("\n OK \n");
+  printf(" \n Calculs en cours... \n");
+
+  resoudreInstance(ws,c1,c2,(short)nSize);
+  lg = ws->lgSE;
+
   /* fin : affichage des resultats */
 	 
-     sortApproximation1(&(listePE.liste[lg]),listePE.lgListe - lg);
      printf("\n\n Compte-rendu\n");
      printf(" ============\n\n");
 
      //showList(nSize, &listeSE);
-     for(i = 0; i < listePE.lgListe; i++)
-       showSolution(i, nSize, &(listePE.liste[i]));
+     for(i = 0; i < listePE->lgListe; i++)
+       showSolution(i, nSize, &(listePE->liste[i]));
      printf(" -- \n");
      // printf("time : %lf (sec) \n",temps);
 
      printf(" Nbre Points non-domines Phase 1 (Supportes extremes + qques non-extremes) : %d\n",      lg);
-     printf(" Nbre Points non-domines Phase 2 : %ld\n",  listePE.lgListe - lg);
-	 printf(" Nbre Total : %ld\n", listePE.lgListe);
+     printf(" Nbre Points non-domines Phase 2 : %ld\n",  listePE->lgListe - lg);
+	 printf(" Nbre Total : %ld\n", listePE->lgListe);
    
-   *z1 = calloc(listePE.lgListe, sizeof(int));
-   *z2 = calloc(listePE.lgListe, sizeof(int));
-   *solutions = calloc(listePE.lgListe * nSize, sizeof(int));
-   *nbsolutions = listePE.lgListe;
+   *z1 = calloc(listePE->lgListe, sizeof(int));
+   *z2 = calloc(listePE->lgListe, sizeof(int));
+   *solutions = calloc(listePE->lgListe * nSize, sizeof(int));
+   *nbsolutions = listePE->lgListe;
 
 
-   for (i = 0; i < listePE.lgListe ; i++){
-	   (*z1)[i] = (listePE.liste[i]).z[0];
-	   (*z2)[i] = (listePE.liste[i]).z[1];
+   for (i = 0; i < listePE->lgListe ; i++){
+	   (*z1)[i] = (listePE->liste[i]).z[0];
+	   (*z2)[i] = (listePE->liste[i]).z[1];
 	   for(j = 0; j < nSize; j++){
-	     (*solutions)[i*nSize + j] = (listePE.liste[i]).X[j];
+	     (*solutions)[i*nSize + j] = (listePE->liste[i]).X[j];
 	   }
 	}
-	//FILE * fOut1;
-	//fOut1 = fopen("res2ph.txt","wt");
-	//fprintf(fOut1,"%ld\n",listePE.lgListe);
-	//fprintf(fOut1,"%d %d\n",(listePE.liste[0]).z[0],(listePE.liste[0]).z[1]); 
-	//for(i = 1;i < listePE.lgListe;i++) 
-		//if ( (listePE.liste[i]).z[0] != (listePE.liste[i - 1]).z[0] )  
-			//fprintf(fOut1,"%d %d\n",(listePE.liste[i]).z[0],(listePE.liste[i]).z[1]);
-	//fclose(fOut1);
+
+   libererEspaceTravail(ws);
+}
+
+void solve_bilap_batch(int *c1, int *c2, int nSize, int nbInstances, int **z1, int **z2, int **solutions, int **debuts)
+{
+int i,j,k,total;
+int *nbsol = (int *) malloc (nbInstances * sizeof(int));
+solution **fronts = (solution **) malloc (nbInstances * sizeof(solution *));
+
+/* un espace de travail par thread, reutilise pour toutes les instances qu'il traite */
+
+#pragma omp parallel private(i)
+  {
+  espaceTravail *ws = creerEspaceTravail();
+
+  #pragma omp for schedule(dynamic)
+  for(k = 0;k < nbInstances;k++)
+	{
+	resoudreInstance(ws,&(c1[k*nSize*nSize]),&(c2[k*nSize*nSize]),(short)nSize);
+	nbsol[k] = ws->listePE.lgListe;
+	fronts[k] = (solution *) malloc (nbsol[k] * sizeof(solution));
+	for(i = 0;i < nbsol[k];i++) copy_Solution(nSize,&(ws->listePE.liste[i]),&(fronts[k][i]));
+	}
+
+  libererEspaceTravail(ws);
+  }
+
+/* rangement des fronts a la suite dans les tableaux resultats */
+
+   *debuts = calloc(nbInstances + 1, sizeof(int));
+   for(k = 0;k < nbInstances;k++) (*debuts)[k + 1] = (*debuts)[k] + nbsol[k];
+   total = (*debuts)[nbInstances];
+
+   *z1 = calloc(total, sizeof(int));
+   *z2 = calloc(total, sizeof(int));
+   *solutions = calloc(total * nSize, sizeof(int));
+
+   for(k = 0;k < nbInstances;k++)
+	{
+	for(i = 0;i < nbsol[k];i++)
+		{
+		(*z1)[(*debuts)[k] + i] = fronts[k][i].z[0];
+		(*z2)[(*debuts)[k] + i] = fronts[k][i].z[1];
+		for(j = 0;j < nSize;j++)
+			(*solutions)[((*debuts)[k] + i)*nSize + j] = fronts[k][i].X[j];
+		}
+	free(fronts[k]);
+	}
+
+free(fronts);
+free(nbsol);
 }
 
 /* EOF */
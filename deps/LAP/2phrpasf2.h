@@ -101,6 +101,43 @@ short int suiv[SizeMax]; //"vrai" bumero des noeuds suivants
 int cout[SizeMax]; //couts de ces suivants
 } noeud;
 
+/** \typedef solution et variables duales d'un probleme agrege, conservees pour reoptimiser la direction suivante */
+
+typedef struct
+{
+int u[SizeMax]; // variables duales des lignes
+int v[SizeMax]; // variables duales des colonnes
+short int x[SizeMax]; // colonne affectee a chaque ligne (- 1 si aucune)
+short int y[SizeMax]; // ligne affectee a chaque colonne (- 1 si aucune)
+} etatDual;
+
+/** \typedef segment entre deux solutions supportees, en attente d'exploration en phase 1 */
+
+typedef struct
+{
+int z11,z12,z21,z22; // extremites du segment
+etatDual *depart; // etat de la direction qui a produit le segment (NULL : resolution de zero)
+} segment;
+
+/** \typedef espace de travail d'une resolution : matrices, liste de solutions et tas du ranking,
+    alloue une fois et reutilise d'une instance a l'autre (trop gros pour la pile d'un thread) */
+
+typedef struct
+{
+int C1[SizeMax][SizeMax];
+int C2[SizeMax][SizeMax];
+int Cd[SizeMax][SizeMax]; // matrice du probleme agrege
+int Ctemp[SizeMax][SizeMax]; // matrice des couts reduits
+int Cb1[SizeMax][SizeMax]; // couts reduits a l'optimum de z1
+int Cb2[SizeMax][SizeMax]; // couts reduits a l'optimum de z2
+int z1min; // optimum de z1
+int z2min; // optimum de z2
+listeSol listePE; // solutions trouvees (phase 1 puis phase 2)
+int lgSE; // nombre de solutions trouvees en phase 1
+tas *tab; // tas du ranking
+int taille; // taille allouee du tas
+} espaceTravail;
+
 // void crono_start();
 
 // void crono_stop();
@@ -380,6 +417,37 @@ void showSolution(int , int , solution *);
 
 void resolutionRecursive(int ,int ,int ,int ,short int ,int C1[SizeMax][SizeMax], int C2[SizeMax][SizeMax],listeSol *);
 
+/** \brief reoptimise le probleme agrege Cd a partir de l'affectation et des duales de l'etat e (si chaud vaut 1) :
+  * les duales sont rendues realisables, les affectations qui ne sont plus serrees sont liberees puis les lignes libres
+  * sont reaffectees par plus courts chemins augmentants. En sortie e contient l'optimum de Cd et ses duales.
+  *
+  * \fn void reoptimiser(int Cd[SizeMax][SizeMax],short int nSize,etatDual *e,int chaud)
+  * \param int Cd[SizeMax][SizeMax]
+  * \param short int nSize
+  * \param etatDual *e
+  * \param int chaud
+  * \retval void
+  */
+void reoptimiser(int Cd[SizeMax][SizeMax],short int ,etatDual *,int );
+
+/** \brief version iterative de resolutionRecursive : les segments en attente sont traites par vagues
+  * (en parallele), chaque direction etant reoptimisee a partir de l'optimum de la direction qui l'a produite
+  *
+  * \fn void resolutionIterative(int z11,int z12,int z21,int z22,short int nSize,int C1[SizeMax][SizeMax],
+                         int C2[SizeMax][SizeMax],listeSol *listeS,etatDual *depart)
+  * \param int z11
+  * \param int z12
+  * \param int z21
+  * \param int z22
+  * \param short int nSize
+  * \param int C1[SizeMax][SizeMax]
+  * \param int C2[SizeMax][SizeMax]
+  * \param listeSol *listeS
+  * \param etatDual *depart
+  * \retval void
+  */
+void resolutionIterative(int ,int ,int ,int ,short int ,int C1[SizeMax][SizeMax], int C2[SizeMax][SizeMax],listeSol *,etatDual *);
+
 /** \brief lit une instance dans un fichier
   *
   * \fn void loadInstance(donnees * uneInstance)
@@ -498,12 +566,61 @@ void ComputeValrank(short int , tas *, int C1[SizeMax][SizeMax], int C2[SizeMax]
 
 tas *ComputeNextSolution(tas *,int *,int *, int C[SizeMax][SizeMax],int C1[SizeMax][SizeMax],int C2[SizeMax][SizeMax], short int ,int *);
 
-void ranking(int C1[SizeMax][SizeMax],int C2[SizeMax][SizeMax],int Cd[SizeMax][SizeMax],int *,short int ,solution *,solution *, listeSol *);
+void ranking(int C1[SizeMax][SizeMax],int C2[SizeMax][SizeMax],int Cd[SizeMax][SizeMax],int *,short int ,solution *,solution *, listeSol *,tas **,int *);
              
-void lancerLesTest(short int ,int C1[SizeMax][SizeMax],int C2[SizeMax][SizeMax], solution *,solution *,listeSol *,int ,int );
+void lancerLesTest(short int ,espaceTravail *, solution *,solution *,int ,int );
+
+/** \brief reduction du probleme avant le ranking du triangle defini par r et s : les arcs qu'aucune solution du triangle
+  * ne peut utiliser (d'apres les couts reduits Cb1, Cb2 et les points nadirs du triangle) sont interdits dans ws->Cd,
+  * les arcs imposes par ces interdictions sont fixes. Retourne 0 si le triangle ne contient aucune solution.
+  *
+  * \fn int reductionTriangle(espaceTravail *ws,short int nSize,solution *r,solution *s,int borne)
+  * \param espaceTravail *ws
+  * \param short int nSize
+  * \param solution *r
+  * \param solution *s
+  * \param int borne
+  * \retval int
+  */
+int reductionTriangle(espaceTravail *,short int ,solution *,solution *,int );
+
+/** \brief alloue un espace de travail
+  *
+  * \fn espaceTravail *creerEspaceTravail()
+  * \retval espaceTravail *
+  */
+espaceTravail *creerEspaceTravail();
+
+/** \brief libere un espace de travail
+  *
+  * \fn void libererEspaceTravail(espaceTravail *ws)
+  * \param espaceTravail *ws
+  * \retval void
+  */
+void libererEspaceTravail(espaceTravail *);
+
+/** \brief resout une instance (phases 1 et 2) dans un espace de travail, les solutions sont dans ws->listePE
+  *
+  * \fn void resoudreInstance(espaceTravail *ws,int *c1,int *c2,short int nSize)
+  * \param espaceTravail *ws
+  * \param int *c1
+  * \param int *c2
+  * \param short int nSize
+  * \retval void
+  */
+void resoudreInstance(espaceTravail *,int *,int *,short int );
 
 /* \brief main
  * \fn solve_bilap_exact()
  */
 void solve_bilap_exact(int *c1,int *c2, int nSize, int **z1, int **z2, int **solutions, int *nbsolutions); 
+
+/* \brief resolution d'une serie d'instances de meme taille, en parallele
+ * \fn solve_bilap_batch()
+ *
+ * c1 et c2 contiennent nbInstances matrices nSize x nSize a la suite. Les fronts sont ranges
+ * a la suite dans z1, z2 et solutions : les solutions de l'instance k sont aux indices
+ * debuts[k] a debuts[k + 1] - 1 (debuts est de taille nbInstances + 1).
+ */
+void solve_bilap_batch(int *c1,int *c2, int nSize, int nbInstances, int **z1, int **z2, int **solutions, int **debuts);
 #endif
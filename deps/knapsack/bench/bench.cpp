@@ -0,0 +1,360 @@
+/**
+ * \file bench.cpp
+ * \brief Measure the running time of the native solvers on generated
+ *        instances.
+ *
+ * Usage: bench [-a solver] [-f family] [-s seed] [-r runs] [-e epsilon]
+ *              [-o file] size...
+ *
+ * The solvers are bi_two_phases, astar, mobb, twophases, dp and lap (default:
+ * all of them). The knapsack instances have two objectives for bi_two_phases and
+ * three for the solvers of the kp namespace. The families are the ones of generator.hpp (default: all the
+ * families of the solver). The default sizes go from 50 to 5000 items; the
+ * assignment instances larger than SizeMax are skipped. A positive epsilon
+ * asks bi_two_phases, twophases and dp for an epsilon-approximation of the
+ * efficient points (default: 0, the exact sets).
+ *
+ * One line is written in the CSV file for each phase of each run:
+ * solver,family,size,seed,phase,seconds,solutions
+ */
+#include "generator.hpp"
+#include "lap.hpp"
+
+#include "bikp/problem/bi_problem.hpp"
+#include "bikp/phase/dp_first_phase.hpp"
+#include "bikp/phase/klp_second_phase.hpp"
+
+#include "kp/astar.hpp"
+#include "kp/dynamic_programming.hpp"
+#include "kp/mobb.hpp"
+#include "kp/phase_1.hpp"
+#include "kp/phase_2.hpp"
+
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <list>
+#include <sys/time.h>
+
+/*----------------------------------------------------------------------------*/
+/**
+ * \brief Measure the elapsed (wall clock) time.
+ */
+class stopwatch
+{
+public:
+  stopwatch() { restart(); }
+
+  /** \brief Reset the starting time reference. */
+  void restart() { gettimeofday( &m_start, NULL ); }
+
+  /** \brief The seconds elapsed since the last restart. */
+  double seconds() const
+  {
+    timeval now;
+    gettimeofday( &now, NULL );
+
+    return (now.tv_sec - m_start.tv_sec)
+      + (now.tv_usec - m_start.tv_usec) / 1000000.0;
+  }
+
+private:
+  /** \brief The starting time reference. */
+  timeval m_start;
+
+}; // class stopwatch
+
+/*----------------------------------------------------------------------------*/
+/**
+ * \brief Write a line of the CSV output.
+ */
+void output
+( std::ostream& os, const std::string& solver, const std::string& family,
+  int size, unsigned int seed, const std::string& phase, double seconds,
+  std::size_t solutions )
+{
+  os << solver << ',' << family << ',' << size << ',' << seed << ','
+     << phase << ',' << seconds << ',' << solutions << std::endl;
+} // output()
+
+/*----------------------------------------------------------------------------*/
+/**
+ * \brief Run the bi-objective two phases method, as bi_two_phases::run() does.
+ */
+void run_bi_two_phases
+( std::ostream& os, const bench::kp_data& d, const std::string& family,
+  unsigned int seed, double epsilon )
+{
+  typedef optimal_set<bi_problem::solution_type> optimal_set_type;
+
+  std::vector<int> p1(d.profit[0]), p2(d.profit[1]), w(d.weight);
+  bi_problem p( 2, d.size, &p1[0], &p2[0], &w[0], d.capacity );
+  stopwatch clock;
+  stopwatch total;
+  dp_first_phase phase_1;
+
+  phase_1.run(p);
+
+  optimal_set_type efficient_solutions( phase_1.get_extreme_solutions() );
+  efficient_solutions.insert( phase_1.get_not_extreme_solutions() );
+
+  output( os, "bi_two_phases", family, d.size, seed, "phase_1",
+          clock.seconds(), efficient_solutions.size() );
+
+  std::size_t nb_sols = efficient_solutions.size();
+
+  if ( efficient_solutions.size() >= 2 )
+    {
+      clock.restart();
+
+      std::list<bi_solution> X_SE
+        ( efficient_solutions.begin(), efficient_solutions.end() );
+      klp_second_phase phase_2;
+
+      phase_2.set_approximation(epsilon);
+      phase_2.run(p, X_SE);
+      nb_sols = phase_2.get_solutions().size();
+
+      output( os, "bi_two_phases", family, d.size, seed, "phase_2",
+              clock.seconds(), nb_sols );
+    }
+
+  output( os, "bi_two_phases", family, d.size, seed, "total",
+          total.seconds(), nb_sols );
+} // run_bi_two_phases()
+
+/*----------------------------------------------------------------------------*/
+/**
+ * \brief Build the instance of the p-objective solvers.
+ */
+kp::knapsack_instance make_instance( const bench::kp_data& d )
+{
+  const int p = d.profit.size();
+  std::vector<float> obj( p * d.size );
+  std::vector<float> w( d.weight.begin(), d.weight.end() );
+
+  for (int k=0; k!=p; ++k)
+    for (int i=0; i!=d.size; ++i)
+      obj[k * d.size + i] = d.profit[k][i];
+
+  return kp::knapsack_instance( p, d.size, &obj[0], &w[0], d.capacity );
+} // make_instance()
+
+/*----------------------------------------------------------------------------*/
+/**
+ * \brief Run the three-objective two phases method, as twophases() does.
+ */
+void run_twophases
+( std::ostream& os, const bench::kp_data& d, const std::string& family,
+  unsigned int seed, double epsilon )
+{
+  kp::knapsack_instance inst( make_instance(d) );
+  stopwatch clock;
+  stopwatch total;
+  kp::phase_1<> phase_1(inst);
+
+  phase_1.run();
+
+  std::size_t nb_sols = phase_1.get_XSEM().size();
+
+  output( os, "twophases", family, d.size, seed, "phase_1", clock.seconds(),
+          nb_sols );
+
+  if ( nb_sols >= 2 )
+    {
+      clock.restart();
+
+      kp::phase_2<> phase_2( inst, phase_1.get_XSEM(), phase_1.get_hull() );
+
+      phase_2.set_approximation(epsilon);
+      phase_2.run();
+      nb_sols = phase_2.get_XNSEM().size();
+
+      output( os, "twophases", family, d.size, seed, "phase_2",
+              clock.seconds(), nb_sols );
+    }
+
+  output( os, "twophases", family, d.size, seed, "total", total.seconds(),
+          nb_sols );
+} // run_twophases()
+
+/*----------------------------------------------------------------------------*/
+/**
+ * \brief Run a single phase solver of the kp namespace (kp::astar or
+ *        kp::mobb).
+ */
+template<typename Solver>
+void run_kp_solver
+( std::ostream& os, const std::string& name, const bench::kp_data& d,
+  const std::string& family, unsigned int seed )
+{
+  kp::knapsack_instance inst( make_instance(d) );
+  kp::maximum_set X;
+  Solver solver;
+  stopwatch clock;
+
+  solver.solve(inst, X);
+
+  output( os, name, family, d.size, seed, "total", clock.seconds(), X.size() );
+} // run_kp_solver()
+
+/*----------------------------------------------------------------------------*/
+/**
+ * \brief Run the dynamic programming algorithm, with the pruning of the states
+ *        by the bounds.
+ */
+void run_dp
+( std::ostream& os, const bench::kp_data& d, const std::string& family,
+  unsigned int seed, double epsilon )
+{
+  kp::knapsack_instance inst( make_instance(d) );
+  kp::pareto_set Z;
+  kp::dynamic_programming solver(true, epsilon);
+  stopwatch clock;
+
+  solver.solve(inst, Z);
+
+  output( os, "dp", family, d.size, seed, "total", clock.seconds(), Z.size() );
+} // run_dp()
+
+/*----------------------------------------------------------------------------*/
+/**
+ * \brief Run the bi-objective assignment solver. Both phases are run by the
+ *        same call, they are timed together.
+ */
+void run_lap
+( std::ostream& os, const bench::lap_data& d, const std::string& family,
+  unsigned int seed )
+{
+  stopwatch clock;
+  const std::size_t nb_sols = bench::solve_lap(d);
+
+  output( os, "lap", family, d.size, seed, "total", clock.seconds(), nb_sols );
+} // run_lap()
+
+/*----------------------------------------------------------------------------*/
+/**
+ * \brief Program entry point.
+ */
+int main( int argc, char* argv[] )
+{
+  std::string solver("all");
+  std::string family("all");
+  std::string output_file("bench.csv");
+  unsigned int seed = 1;
+  int runs = 1;
+  double epsilon = 0;
+  std::vector<int> sizes;
+
+  for (int i=1; i!=argc; ++i)
+    {
+      const std::string arg(argv[i]);
+
+      if ( (arg.size() == 2) && (arg[0] == '-') && (i + 1 != argc) )
+        {
+          ++i;
+
+          switch(arg[1])
+            {
+            case 'a': solver = argv[i]; break;
+            case 'f': family = argv[i]; break;
+            case 's': seed = std::strtoul( argv[i], NULL, 10 ); break;
+            case 'r': runs = std::atoi( argv[i] ); break;
+            case 'e': epsilon = std::atof( argv[i] ); break;
+            case 'o': output_file = argv[i]; break;
+            default:
+              std::cerr << "unknown option " << arg << std::endl;
+              return 1;
+            }
+        }
+      else
+        sizes.push_back( std::atoi(argv[i]) );
+    }
+
+  if ( sizes.empty() )
+    {
+      const int default_sizes[] = { 50, 100, 200, 500, 1000, 2000, 5000 };
+      sizes.assign( default_sizes, default_sizes + 7 );
+    }
+
+  std::vector<bench::kp_family> kp_families;
+  std::vector<bench::lap_family> lap_families;
+  bench::kp_family kf;
+  bench::lap_family lf;
+
+  if ( family == "all" )
+    {
+      kp_families.push_back( bench::kp_uncorrelated );
+      kp_families.push_back( bench::kp_weakly_correlated );
+      kp_families.push_back( bench::kp_strongly_correlated );
+      kp_families.push_back( bench::kp_conflicting );
+      lap_families.push_back( bench::lap_random );
+      lap_families.push_back( bench::lap_correlated );
+    }
+  else if ( bench::kp_family_from_string(family, kf) )
+    kp_families.push_back( kf );
+  else if ( bench::lap_family_from_string(family, lf) )
+    lap_families.push_back( lf );
+  else
+    {
+      std::cerr << "unknown family " << family << std::endl;
+      return 1;
+    }
+
+  std::ofstream os( output_file.c_str() );
+  os << "solver,family,size,seed,phase,seconds,solutions" << std::endl;
+
+  for (std::size_t s=0; s!=sizes.size(); ++s)
+    for (int r=0; r!=runs; ++r)
+      {
+        const unsigned int instance_seed = seed + r;
+
+        for (std::size_t f=0; f!=kp_families.size(); ++f)
+          {
+            bench::kp_data d;
+            const std::string name( bench::to_string(kp_families[f]) );
+
+            if ( (solver == "all") || (solver == "bi_two_phases") )
+              {
+                bench::generate_kp
+                  ( kp_families[f], sizes[s], 2, instance_seed, d );
+                run_bi_two_phases( os, d, name, instance_seed, epsilon );
+              }
+
+            // the solvers of the kp namespace handle three objectives
+            bench::generate_kp
+              ( kp_families[f], sizes[s], 3, instance_seed, d );
+
+            if ( (solver == "all") || (solver == "astar") )
+              run_kp_solver<kp::astar>( os, "astar", d, name, instance_seed );
+            if ( (solver == "all") || (solver == "mobb") )
+              run_kp_solver<kp::mobb>( os, "mobb", d, name, instance_seed );
+            if ( (solver == "all") || (solver == "twophases") )
+              run_twophases( os, d, name, instance_seed, epsilon );
+            if ( (solver == "all") || (solver == "dp") )
+              run_dp( os, d, name, instance_seed, epsilon );
+          }
+
+        if ( (solver != "all") && (solver != "lap") )
+          continue;
+
+        if ( sizes[s] > bench::lap_size_max() )
+          {
+            std::cerr << "lap: size " << sizes[s] << " skipped (SizeMax is "
+                      << bench::lap_size_max() << ")." << std::endl;
+            continue;
+          }
+
+        for (std::size_t f=0; f!=lap_families.size(); ++f)
+          {
+            bench::lap_data d;
+
+            bench::generate_lap
+              ( lap_families[f], sizes[s], instance_seed, d );
+            run_lap
+              ( os, d, bench::to_string(lap_families[f]), instance_seed );
+          }
+      }
+
+  return 0;
+} // main()
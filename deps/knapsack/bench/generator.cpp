@@ -0,0 +1,214 @@
+/**
+ * \file generator.cpp
+ * \brief Implementation of the instance generators.
+ */
+#include "generator.hpp"
+
+#include <algorithm>
+
+/*----------------------------------------------------------------------------*/
+/**
+ * \brief Constructor.
+ * \param seed The seed of the sequence.
+ */
+bench::random_generator::random_generator( unsigned int seed )
+  : m_state(seed)
+{
+
+} // random_generator::random_generator()
+
+/*----------------------------------------------------------------------------*/
+/**
+ * \brief Get a number uniformly drawn in [a, b].
+ * \param a The lowest value.
+ * \param b The highest value.
+ */
+int bench::random_generator::uniform( int a, int b )
+{
+  m_state = m_state * 1664525u + 1013904223u;
+
+  // the low order bits of a LCG are not very random
+  return a + (int)( (m_state >> 8) % (unsigned int)(b - a + 1) );
+} // random_generator::uniform()
+
+/*----------------------------------------------------------------------------*/
+/**
+ * \brief Generate an instance of the multi-objective knapsack problem.
+ * \param f The family of the instance.
+ * \param n The number of items.
+ * \param p The number of objectives (at least two).
+ * \param seed The seed of the random generator.
+ * \param inst (out) The instance.
+ *
+ * The coefficients are in [1, R] with R = 1000 :
+ *  - uncorrelated : the profits and the weight are independent,
+ *  - weakly correlated : the profits are in [w - R/10, w + R/10],
+ *  - strongly correlated : the first profit is w + R/10, the other ones are
+ *    independent,
+ *  - conflicting : the other profits are in [0.9R - p1, 1.1R - p1] and w is in
+ *    [p1 + p2 - 0.2R, p1 + p2 + 0.2R].
+ *
+ * The capacity is half the sum of the weights.
+ */
+void bench::generate_kp
+( kp_family f, int n, int p, unsigned int seed, kp_data& inst )
+{
+  const int r = 1000;
+  random_generator g(seed);
+  long sum_weight = 0;
+
+  inst.size = n;
+  inst.profit.assign( p, std::vector<int>(n) );
+  inst.weight.resize(n);
+
+  for (int i=0; i!=n; ++i)
+    {
+      int w;
+
+      switch(f)
+        {
+        case kp_uncorrelated:
+          for (int k=0; k!=p; ++k)
+            inst.profit[k][i] = g.uniform(1, r);
+          w = g.uniform(1, r);
+          break;
+        case kp_weakly_correlated:
+          w = g.uniform(1, r);
+          for (int k=0; k!=p; ++k)
+            inst.profit[k][i] =
+              g.uniform( std::max(1, w - r / 10), w + r / 10 );
+          break;
+        case kp_strongly_correlated:
+          w = g.uniform(1, r);
+          inst.profit[0][i] = w + r / 10;
+          for (int k=1; k!=p; ++k)
+            inst.profit[k][i] = g.uniform(1, r);
+          break;
+        default:
+          {
+            const int p1 = g.uniform(1, r);
+
+            inst.profit[0][i] = p1;
+            for (int k=1; k!=p; ++k)
+              inst.profit[k][i] = g.uniform
+                ( std::max(1, 9 * r / 10 - p1),
+                  std::min(r, 11 * r / 10 - p1) );
+
+            const int s = p1 + inst.profit[1][i];
+            w = g.uniform( std::max(1, s - r / 5), s + r / 5 );
+          }
+        }
+
+      inst.weight[i] = w;
+      sum_weight += w;
+    }
+
+  inst.capacity = (int)(sum_weight / 2);
+} // generate_kp()
+
+/*----------------------------------------------------------------------------*/
+/**
+ * \brief Generate an instance of the bi-objective assignment problem.
+ * \param f The family of the instance.
+ * \param n The number of rows.
+ * \param seed The seed of the random generator.
+ * \param inst (out) The instance.
+ *
+ * The costs are in [0, 19]. In the correlated family, the second cost is
+ * 19 - c1, plus or minus 5.
+ */
+void
+bench::generate_lap( lap_family f, int n, unsigned int seed, lap_data& inst )
+{
+  random_generator g(seed);
+
+  inst.size = n;
+  inst.cost_1.resize(n * n);
+  inst.cost_2.resize(n * n);
+
+  for (int i=0; i!=n * n; ++i)
+    {
+      inst.cost_1[i] = g.uniform(0, 19);
+
+      if ( f == lap_random )
+        inst.cost_2[i] = g.uniform(0, 19);
+      else
+        inst.cost_2[i] =
+          std::min( 19, std::max(0, 19 - inst.cost_1[i] + g.uniform(-5, 5)) );
+    }
+} // generate_lap()
+
+/*----------------------------------------------------------------------------*/
+/**
+ * \brief Get a knapsack family from its name.
+ * \param s The name of the family.
+ * \param f (out) The family.
+ * \return false if s is not the name of a family.
+ */
+bool bench::kp_family_from_string( const std::string& s, kp_family& f )
+{
+  bool result = true;
+
+  if ( s == "uncorrelated" )
+    f = kp_uncorrelated;
+  else if ( s == "weakly" )
+    f = kp_weakly_correlated;
+  else if ( s == "strongly" )
+    f = kp_strongly_correlated;
+  else if ( s == "conflicting" )
+    f = kp_conflicting;
+  else
+    result = false;
+
+  return result;
+} // kp_family_from_string()
+
+/*----------------------------------------------------------------------------*/
+/**
+ * \brief Get an assignment family from its name.
+ * \param s The name of the family.
+ * \param f (out) The family.
+ * \return false if s is not the name of a family.
+ */
+bool bench::lap_family_from_string( const std::string& s, lap_family& f )
+{
+  bool result = true;
+
+  if ( s == "random" )
+    f = lap_random;
+  else if ( s == "correlated" )
+    f = lap_correlated;
+  else
+    result = false;
+
+  return result;
+} // lap_family_from_string()
+
+/*----------------------------------------------------------------------------*/
+/**
+ * \brief Get the name of a knapsack family.
+ * \param f The family.
+ */
+std::string bench::to_string( kp_family f )
+{
+  switch(f)
+    {
+    case kp_uncorrelated: return "uncorrelated";
+    case kp_weakly_correlated: return "weakly";
+    case kp_strongly_correlated: return "strongly";
+    default: return "conflicting";
+    }
+} // to_string()
+
+/*----------------------------------------------------------------------------*/
+/**
+ * \brief Get the name of an assignment family.
+ * \param f The family.
+ */
+std::string bench::to_string( lap_family f )
+{
+  if ( f == lap_random )
+    return "random";
+  else
+    return "correlated";
+} // to_string()
@@ -0,0 +1,97 @@
+/**
+ * \file generator.hpp
+ * \brief Deterministic generators of multi-objective knapsack and assignment
+ *        instances, for the benchmarks.
+ */
+#ifndef __BENCH_GENERATOR_HPP__
+#define __BENCH_GENERATOR_HPP__
+
+#include <string>
+#include <vector>
+
+namespace bench
+{
+  /**
+   * \brief A linear congruential generator. Unlike rand(), it gives the same
+   *        sequence on every platform, so the instances depend only on the
+   *        seed.
+   */
+  class random_generator
+  {
+  public:
+    explicit random_generator( unsigned int seed );
+
+    int uniform( int a, int b );
+
+  private:
+    /** \brief The current state of the generator. */
+    unsigned int m_state;
+
+  }; // class random_generator
+
+  /** \brief The families of multi-objective knapsack instances. */
+  enum kp_family
+    {
+      kp_uncorrelated,
+      kp_weakly_correlated,
+      kp_strongly_correlated,
+      kp_conflicting
+    }; // enum kp_family
+
+  /** \brief The families of bi-objective assignment instances. */
+  enum lap_family
+    {
+      lap_random,
+      lap_correlated
+    }; // enum lap_family
+
+  /**
+   * \brief An instance of the multi-objective knapsack problem, in the format
+   *        expected by the C interfaces of the solvers.
+   */
+  struct kp_data
+  {
+    /** \brief The number of items. */
+    int size;
+
+    /** \brief The profits of the items, profit[k][i] is the profit of the
+        item i on the objective k. */
+    std::vector< std::vector<int> > profit;
+
+    /** \brief The weights of the items. */
+    std::vector<int> weight;
+
+    /** \brief The capacity of the knapsack. */
+    int capacity;
+
+  }; // struct kp_data
+
+  /**
+   * \brief An instance of the bi-objective assignment problem, the costs are
+   *        stored row by row.
+   */
+  struct lap_data
+  {
+    /** \brief The number of rows (and columns). */
+    int size;
+
+    /** \brief The costs on the first objective. */
+    std::vector<int> cost_1;
+
+    /** \brief The costs on the second objective. */
+    std::vector<int> cost_2;
+
+  }; // struct lap_data
+
+  void generate_kp
+  ( kp_family f, int n, int p, unsigned int seed, kp_data& inst );
+  void generate_lap( lap_family f, int n, unsigned int seed, lap_data& inst );
+
+  bool kp_family_from_string( const std::string& s, kp_family& f );
+  bool lap_family_from_string( const std::string& s, lap_family& f );
+  std::string to_string( kp_family f );
+  std::string to_string( lap_family f );
+
+} // namespace bench
+
+#endif // __BENCH_GENERATOR_HPP__
@@ -0,0 +1,38 @@
+/**
+ * \file lap.cpp
+ * \brief Implementation of the access to the bi-objective assignment solver.
+ */
+#include "lap.hpp"
+
+extern "C"
+{
+#include "2phrpasf2.h"
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+ * \brief The largest instance the solver accepts.
+ */
+int bench::lap_size_max()
+{
+  return SizeMax;
+} // lap_size_max()
+
+/*----------------------------------------------------------------------------*/
+/**
+ * \brief Solve an instance as solve_bilap_exact() does, without the report.
+ * \param d The instance.
+ * \return The number of efficient solutions.
+ */
+std::size_t bench::solve_lap( const lap_data& d )
+{
+  std::vector<int> c1(d.cost_1), c2(d.cost_2);
+  espaceTravail *ws = creerEspaceTravail();
+
+  resoudreInstance( ws, &c1[0], &c2[0], (short)d.size );
+
+  const std::size_t result = ws->listePE.lgListe;
+  libererEspaceTravail(ws);
+
+  return result;
+} // solve_lap()
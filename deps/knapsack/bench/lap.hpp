@@ -0,0 +1,21 @@
+/**
+ * \file lap.hpp
+ * \brief Access to the bi-objective assignment solver. Its header can not be
+ *        included together with the ones of bikp (both declare a type named
+ *        solution).
+ */
+#ifndef __BENCH_LAP_HPP__
+#define __BENCH_LAP_HPP__
+
+#include "generator.hpp"
+
+#include <cstddef>
+
+namespace bench
+{
+  int lap_size_max();
+  std::size_t solve_lap( const lap_data& d );
+
+} // namespace bench
+
+#endif // __BENCH_LAP_HPP__
@@ -6,5 +6,41 @@
 extern "C"
 #endif
 void bi2phases( int nb_obj, int sz, int *obj1, int *obj2, int *weigths ,int capacity ,int * &z1, int * &z2, int * &solW, bool * &res, int &nbSol);
+#ifdef __cplusplus
+extern "C"
+#endif
+void bi2phases_approx( int nb_obj, int sz, int *obj1, int *obj2, int *weigths ,int capacity, double epsilon, int * &z1, int * &z2, int * &solW, bool * &res, int &nbSol);
+#ifdef __cplusplus
+extern "C"
+#endif
+void bi2phases_anytime( int nb_obj, int sz, int *obj1, int *obj2, int *weigths ,int capacity, double time_limit, int * &z1, int * &z2, int * &solW, bool * &res, int &nbSol, double * &gaps, int &nbGaps);
+#ifdef __cplusplus
+extern "C"
+#endif
+void* bi2phases_session_create( int sz, int *obj1, int *obj2, int *weigths ,int capacity );
+#ifdef __cplusplus
+extern "C"
+#endif
+void bi2phases_session_set_capacity( void *session, int capacity );
+#ifdef __cplusplus
+extern "C"
+#endif
+void bi2phases_session_set_item( void *session, int i, int p1, int p2, int w );
+#ifdef __cplusplus
+extern "C"
+#endif
+void bi2phases_session_add_item( void *session, int p1, int p2, int w );
+#ifdef __cplusplus
+extern "C"
+#endif
+void bi2phases_session_remove_item( void *session, int i );
+#ifdef __cplusplus
+extern "C"
+#endif
+void bi2phases_session_solve( void *session, int * &z1, int * &z2, int * &solW, bool * &res, int &nbSol);
+#ifdef __cplusplus
+extern "C"
+#endif
+void bi2phases_session_destroy( void *session );
 #endif
 
@@ -64,6 +64,8 @@ public:
     typedef typename solution_list::const_iterator list_iterator;
 
   public:
+    typedef typename list_iterator::value_type value_type;
+    typedef typename list_iterator::difference_type difference_type;
     typedef typename list_iterator::reference reference;
     typedef typename list_iterator::pointer pointer;
 
@@ -74,10 +76,10 @@ public:
     const_iterator()
     { }
 
-    const_iterator(map_iterator it)
-      : m_map_it(it)
+    const_iterator(map_iterator it, map_iterator end)
+      : m_map_it(it), m_map_end(end)
     {
-      if ( m_map_it != map_iterator() )
+      if ( m_map_it != m_map_end )
 	m_list_it = m_map_it->second.begin();
     }
     
@@ -87,7 +89,7 @@ public:
       
       if ( m_map_it == that.m_map_it )
 	{
-	  if ( m_map_it == map_iterator() )
+	  if ( m_map_it == m_map_end )
 	    result = true;
 	  else
 	    result = (m_list_it == that.m_list_it);
@@ -111,7 +113,7 @@ public:
       if ( m_list_it == m_map_it->second.end() )
 	{
 	  ++m_map_it;
-	  if ( m_map_it != map_iterator() )
+	  if ( m_map_it != m_map_end )
 	    m_list_it = m_map_it->second.begin();
 	}
 
@@ -129,6 +131,9 @@ public:
     /** \brief Iterator in the map of lists. */
     map_iterator m_map_it;
 
+    /** \brief Iterator past the last list of the map. */
+    map_iterator m_map_end;
+
     /** \brief Iterator in the list of solutions. */
     list_iterator m_list_it;
 
@@ -177,7 +177,7 @@ template<class Solution, class SolutionTraits>
 typename combined_maximum_complete_set<Solution, SolutionTraits>::const_iterator
 combined_maximum_complete_set<Solution, SolutionTraits>::begin() const
 {
-  return const_iterator( m_solutions.begin() );
+  return const_iterator( m_solutions.begin(), m_solutions.end() );
 } // combined_maximum_complete_set::begin()
 
 /*----------------------------------------------------------------------------*/
@@ -188,7 +188,7 @@ template<class Solution, class SolutionTraits>
 typename combined_maximum_complete_set<Solution, SolutionTraits>::const_iterator
 combined_maximum_complete_set<Solution, SolutionTraits>::end() const
 {
-  return const_iterator( m_solutions.end() );
+  return const_iterator( m_solutions.end(), m_solutions.end() );
 } // combined_maximum_complete_set::end()
 
 /*----------------------------------------------------------------------------*/
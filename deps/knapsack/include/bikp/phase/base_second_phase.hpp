@@ -21,7 +21,10 @@
 #define __BIKP_BASE_SECOND_PHASE_HPP__
 
 #include <iostream>
+#include <list>
 #include <map>
+#include <vector>
+#include <sys/time.h>
 
 #include "bikp/problem/bi_problem.hpp"
 #include "bikp/tool/logger.hpp"
@@ -82,6 +85,32 @@ public:
 
   }; // class area_lesser
 
+  /**
+   * \brief A triangle that has not been explored before the time limit, with
+   *        the bounds on the points that may be missing in it.
+   *
+   * The bounds are on the combined value height * z.profit_1 + width *
+   * z.profit_2 of the points z, where width and height are the dimensions of
+   * the triangle.
+   */
+  class triangle_gap
+  {
+  public:
+    /** \brief Point of the top-left corner. */
+    bi_profit top_left;
+
+    /** \brief Point of the bottom-right corner. */
+    bi_profit bottom_right;
+
+    /** \brief Lower bound on the combined value of the missing points. */
+    real_type lower_bound;
+
+    /** \brief The combined value of the corners, an upper bound on the
+	combined value of the missing points. */
+    real_type upper_bound;
+
+  }; // class triangle_gap
+
   /**
    * \brief The set of the triangles in the search space, and the solutions
    *        found for each triangle.
@@ -99,7 +128,9 @@ public:
       local_point_set();
       local_point_set( const bi_profit& p1, const bi_profit& p2 );
 
-      void compute_lower_bound();
+      void compute_lower_bound
+      ( real_type epsilon, const bi_profit& origin,
+	const combined_triangle::ceiling_type* ceiling );
 
     public:
       /** \brief Tell if the triangle is locked (can't insert more
@@ -121,6 +152,10 @@ public:
       /** \brief The combined value of the best solutions. */
       real_type upper_bound;
 
+      /** \brief Tell if some points have been inserted since the last
+	  computation of the lower bound. */
+      bool changed;
+
     }; // class local_point_set
 
     /** \brief A container that stores triangles. The key is the value of the
@@ -128,6 +163,7 @@ public:
     typedef std::map<real_type, local_point_set*> point_set_map;
 
   public:
+    triangle_set();
     ~triangle_set();
 
     void add( const triangle& t );
@@ -144,9 +180,12 @@ public:
         insert( *first );
     }
 
-    void tighten();
+    void set_approximation( real_type epsilon, const bi_profit& origin );
+    void set_ceiling( const combined_triangle::ceiling_type* ceiling );
+    void tighten( std::list<triangle>& tightened );
     real_type strip_width( const triangle& t ) const;
     real_type get_lower_bound( const triangle& t ) const;
+    real_type get_upper_bound( const triangle& t ) const;
 
     void large_cut( std::list<bi_profit>& ub ) const;
 
@@ -155,14 +194,32 @@ public:
 	top-left corner on the first objective. */
      point_set_map m_triangles;
 
+    /** \brief The relative tolerance on the points to find. */
+    real_type m_epsilon;
+
+    /** \brief The profit to add to the points to get the profit in the
+	initial problem. */
+    bi_profit m_origin;
+
+    /** \brief The points under which the points to find are, in the initial
+	problem. NULL if there is no such constraint. */
+    const combined_triangle::ceiling_type* m_ceiling;
+
   }; // class triangle_set
 
 public:
   base_second_phase( const std::string& name );
   virtual ~base_second_phase() {}
 
+  void set_time_limit( double seconds );
+  void set_approximation( double epsilon );
+  void set_known_solutions( const std::list<bi_solution>& X );
+  void set_known_solutions
+  ( const std::list<bi_solution>& X, const std::list<bi_profit>& ceiling );
+
   void run( const bi_problem& p, const std::list<bi_solution>& X_SE );
   const maximum_complete_set<bi_solution>& get_solutions() const;
+  const std::list<triangle_gap>& get_unexplored_triangles() const;
   void save( std::ostream& os ) const;
 
 protected:
@@ -181,11 +238,13 @@ private:
   void reduce_and_run
   ( const bi_problem& p, const std::list<bi_solution>& X_SE );
   void run_solver( const bi_problem& p, const std::list<bi_profit>& Z_SE );
+  bool time_out() const;
 
-  unsigned int
-  next_triangle_index( const std::vector<triangle>& triangles ) const;
+  void add_unexplored_triangle( const triangle& t );
+  void restore_unexplored_triangles( const bi_profit& delta );
 
-  void calculate_triangle( const bi_problem& p, const triangle& t );
+  void calculate_triangle
+  ( const bi_problem& p, const triangle& t, std::list<triangle>& tightened );
 
   void solve( const combined_problem& mono_p, const triangle& t,
 	      std::list<combined_solution>& new_solutions,
@@ -214,6 +273,34 @@ private:
       now. */
   pareto_set<bi_profit> m_pareto_front;
 
+  /** \brief The maximum duration of run(), in seconds. There is no limit if
+      it is negative. */
+  double m_time_limit;
+
+  /** \brief The date at which run() started. */
+  timeval m_start_time;
+
+  /** \brief The triangles not explored before the time limit. */
+  std::list<triangle_gap> m_unexplored_triangles;
+
+  /** \brief The relative tolerance on the solutions to find. */
+  double m_epsilon;
+
+  /** \brief The profit of the variables fixed by the global reduction. */
+  bi_profit m_origin;
+
+  /** \brief Feasible solutions known before the run. */
+  std::list<bi_solution> m_known_solutions;
+
+  /** \brief Tell if the points to find are all under a point of
+      m_ceiling. */
+  bool m_use_ceiling;
+
+  /** \brief For each profit on the first objective of the points of the
+      ceiling, the greatest profit on the second objective of the points
+      greater or equal on the first objective. */
+  combined_triangle::ceiling_type m_ceiling;
+
 };  // class base_second_phase
 
 #endif // __BIKP_BASE_SECOND_PHASE_HPP__
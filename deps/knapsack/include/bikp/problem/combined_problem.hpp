@@ -83,7 +83,7 @@ public:
    */
   inline profit_type profit( unsigned int index ) const
     {
-      return m_profit[ m_correspondence[index] ];
+      return m_profit[index];
     } // profit()
 
   /**
@@ -92,7 +92,7 @@ public:
    */
   inline weight_type weight( unsigned int index ) const
     {
-      return m_weight[ this->m_correspondence[index] ];
+      return m_weight[index];
     } // weight()
 
   unsigned int size() const;
@@ -104,14 +104,16 @@ public:
   inline real_type get_efficiency( unsigned int obj, unsigned int index ) const
   {
     assert( obj == 0 );
-    return m_efficiency[ this->m_correspondence[index] ];
+    return m_efficiency[index];
   }
 
+  void sort_by_decreasing_efficiency();
+
 private:
-  /** \brief Profits of the items. */
+  /** \brief Profits of the items, in the current sort. */
   std::vector<profit_type> m_profit;
 
-  /** \brief Weight of the items. */
+  /** \brief Weight of the items, in the current sort. */
   std::vector<weight_type> m_weight;
 
   /** \brief Maximum capacity. */
@@ -71,3 +71,25 @@ void sortable_mono_problem::restore_solution
   assert( real_sol.is_feasible() );
   assert( sol.is_full() ? real_sol.is_full() : true );
 } // sorting_tools::restore_solution()
+
+/*----------------------------------------------------------------------------*/
+/**
+ * \brief Move the data of the variables to match the current sort.
+ * \param v (in/out) The data of the variables, in the previous sort.
+ * \param previous The value of m_local_index in the previous sort.
+ */
+template<typename T>
+void sortable_mono_problem::reorder
+( std::vector<T>& v, const std::vector<std::size_t>& previous ) const
+{
+  assert( v.size() == m_correspondence.size() );
+  assert( previous.size() == m_correspondence.size() );
+
+  std::vector<T> result;
+  result.reserve( v.size() );
+
+  for (unsigned int i=0; i!=m_correspondence.size(); ++i)
+    result.push_back( v[ previous[m_correspondence[i]] ] );
+
+  v.swap(result);
+} // sortable_mono_problem::reorder()
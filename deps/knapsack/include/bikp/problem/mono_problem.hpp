@@ -62,7 +62,7 @@ public:
   inline profit_type profit( unsigned int index ) const
   {
     assert ( index < size() );
-    return m_profit[ this->m_correspondence[index] ];
+    return m_profit[index];
   } // profit()
 
   /**
@@ -72,7 +72,7 @@ public:
   inline weight_type weight( unsigned int index ) const
   {
     assert( index < size() );
-    return m_weight[ this->m_correspondence[index] ];
+    return m_weight[index];
   } // weight()
 
   unsigned int size() const;
@@ -86,7 +86,7 @@ public:
   inline real_type get_efficiency( unsigned int obj, unsigned int index ) const
   {
     assert( obj == 0 );
-    return m_efficiency[ this->m_correspondence[index] ];
+    return m_efficiency[index];
   }
 
   unsigned int local_index( unsigned int index ) const;
@@ -95,17 +95,14 @@ public:
 
 private:
   
-  /** \brief The profits of the variables. */
+  /** \brief The profits of the variables, in the current sort. */
   std::vector<profit_type> m_profit;
 
-  /** \brief The weight of the variables. */
+  /** \brief The weight of the variables, in the current sort. */
   std::vector<weight_type> m_weight;
 
   const weight_type m_capacity;
 
-  /** \brief Correspondence : real index -> local index. */
-  std::vector<std::size_t> m_local_index;
-
 }; // class mono_problem
 
 /** \brief The type of the solution for this problem. */
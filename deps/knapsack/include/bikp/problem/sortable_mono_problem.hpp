@@ -21,12 +21,19 @@
 #ifndef __BIKP_SORTABLE_MONO_PROBLEM_HPP__
 #define __BIKP_SORTABLE_MONO_PROBLEM_HPP__
 
+#include <cassert>
 #include <vector>
 #include "bikp/tool/types.hpp"
 
 /**
  * \brief Parent class for mono-objective problems for which we want to be able
  *        to sort items by efficiency.
+ *
+ * The data of the items are stored in the order of the current sort, so the
+ * accessors of the child classes read them without going through the
+ * correspondence of the indices. The correspondence is only used to convert
+ * the solutions and the indices from and to the parent problem.
+ *
  * \author Julien Jorge
  */
 class sortable_mono_problem
@@ -44,12 +51,21 @@ public:
 
   void sort_by_decreasing_efficiency();
 
+protected:
+  template<typename T>
+  void reorder
+  ( std::vector<T>& v, const std::vector<std::size_t>& previous ) const;
+
 protected:
   /** \brief Correspondence of the index of the variables between the current
       sort and the parent problem sort. */
   std::vector<std::size_t> m_correspondence;
 
-  /** \brief Efficiency of the variables. */
+  /** \brief Correspondence of the index of the variables between the parent
+      problem sort and the current sort. */
+  std::vector<std::size_t> m_local_index;
+
+  /** \brief Efficiency of the variables, in the current sort. */
   std::vector<real_type> m_efficiency;
 
 }; // class sortable_mono_problem
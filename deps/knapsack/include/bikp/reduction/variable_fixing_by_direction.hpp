@@ -27,6 +27,7 @@
 
 #include <string>
 #include <list>
+#include <vector>
 
 /**
  * \brief Variable reduction applyable to a combined_problem, that uses upper
@@ -47,6 +48,10 @@ public:
   ( const bi_problem& p, const std::list<bi_solution>& X_SE );
 
 private:
+  void fix_in_direction
+  ( const bi_problem& p, const bi_profit& z_left, const bi_profit& z_right,
+    std::string& pattern ) const;
+
   void make_pattern
   ( std::string& pattern, const std::list<bi_solution>& X_SE ) const;
 
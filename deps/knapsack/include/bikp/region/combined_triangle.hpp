@@ -22,6 +22,7 @@
 
 #include "bikp/problem/combined_problem.hpp"
 
+#include <map>
 #include <sstream>
 
 /**
@@ -45,6 +46,12 @@ public:
   /** \brief The type of the current class. */
   typedef combined_triangle self_type;
 
+  /** \brief Points of the initial problem under which the points to find are.
+      The key is the profit on the first objective of a point, the value is
+      the greatest profit on the second objective of the points from this
+      one. */
+  typedef std::map<real_type, real_type> ceiling_type;
+
 public:
   combined_triangle( bool keep_equivalence, const profit_type& top_left,
 		     const profit_type& bottom_right,
@@ -72,6 +79,9 @@ public:
   template<class Iterator>
   void tighten( Iterator first, Iterator last );
 
+  void set_approximation( real_type epsilon, const bi_profit& origin );
+  void set_ceiling( const ceiling_type* ceiling, const bi_profit& origin );
+
   profit_type get_top_left() const { return m_top_left; }
   profit_type get_bottom_right() const { return m_bottom_right; }
   real_type get_top() const { return m_top_left.profit_2; }
@@ -83,10 +93,15 @@ public:
 
 private:
   template<class Iterator>
-  void tighten_keep( Iterator first, Iterator last );
+  void tighten_staircase( Iterator first, Iterator last );
 
   template<class Iterator>
-  void tighten_dont_keep( Iterator first, Iterator last );
+  void tighten_approximation( Iterator first, Iterator last );
+
+  profit_type scale( const profit_type& p ) const;
+
+  bool under_ceiling( real_type x, real_type y ) const;
+  void lower( real_type& val, bool& found, real_type x, real_type y ) const;
 
 protected:
   /** \brief Tell if we have to keep the possibility to have equivalent
@@ -109,6 +124,18 @@ private:
   /** \brief Coefficient on the second objective. */
   const real_type m_lambda_2;
 
+  /** \brief The relative tolerance on the points to find. Zero if all the
+      points must be found. */
+  real_type m_epsilon;
+
+  /** \brief The profit to add to the points of the region to get the profit
+      in the initial problem, where the tolerance and the ceiling apply. */
+  bi_profit m_origin;
+
+  /** \brief The points under which the points to find are, NULL if any
+      point of the region may be found. */
+  const ceiling_type* m_ceiling;
+
 }; // class combined_triangle
 
 #include "bikp/region/impl/combined_triangle.tpp"
@@ -32,125 +32,123 @@
 template<class Iterator>
 void combined_triangle::tighten( Iterator first, Iterator last )
 {
-  if ( first != last )
-    {
-      if (m_keep_equivalence)
-	tighten_keep( first, last );
-      else
-	tighten_dont_keep( first, last );
-    }
+  if ( m_epsilon > 0 )
+    tighten_approximation( first, last );
+  else if ( (first != last) || (m_ceiling != NULL) )
+    tighten_staircase( first, last );
 } // combined_triangle::tighten()
 
 /*----------------------------------------------------------------------------*/
 /**
- * \brief Reduce the region according to a set of points in the case where we
- *        keep equivalent solutions.
+ * \brief Reduce the region according to the staircase made by a set of
+ *        points.
  *
- * The minimum combined objective of the solutions in the region is set equal to
- * or greater than the minimum combined objective value of the potential
- * solutions in the triangle, according to the set.
+ * The minimum combined objective is the one of the nadirs of the staircase
+ * + (1,1), and of the points and the corners if we keep equivalent solutions.
+ * With a ceiling, the points and the nadirs + (1,1) above it are ignored. If
+ * they are all ignored, the bound is above the segment between the corners.
  *
  * \param first Iterator on the first point in the set.
  * \param last Iterator past the last point in the set.
  */
 template<class Iterator>
-void combined_triangle::tighten_keep( Iterator first, Iterator last )
+void combined_triangle::tighten_staircase( Iterator first, Iterator last )
 {
-  Iterator second(first);
-  real_type m, val;
-  
-  ++second;
-  
-  // top left
-  val = m_lambda_1 * m_top_left.profit_1 + m_lambda_2 * m_top_left.profit_2;
+  real_type val(0);
+  bool found(false);
+  real_type left = m_top_left.profit_1;
 
-  // the nadir on his right + (1,1)
-  m = m_lambda_1 * (m_top_left.profit_1 + 1)
-    + m_lambda_2 * (((profit_type)*first).profit_2 + 1);
+  if ( m_ceiling != NULL )
+    {
+      val = m_lambda_1 * m_top_left.profit_1 + m_lambda_2 * m_top_left.profit_2
+	+ 1;
+      found = true;
+    }
 
-  if ( m < val )
-    val = m;
+  if (m_keep_equivalence)
+    lower( val, found, m_top_left.profit_1, m_top_left.profit_2 );
 
-  for ( ; second != last; ++first, ++second)
+  for ( ; first != last; ++first )
     {
-      // the point
-      m = m_lambda_1 * ((profit_type)*first).profit_1
-	+ m_lambda_2 * ((profit_type)*first).profit_2;
-      
-      if ( m < val )
-	val = m;
+      const profit_type p( *first );
 
-      // the nadir on his right + (1,1)
-      m = m_lambda_1 * (((profit_type)*first).profit_1 + 1)
-	+ m_lambda_2 * (((profit_type)*second).profit_2 + 1);
+      // the nadir on the left of the point + (1,1)
+      lower( val, found, left + 1, p.profit_2 + 1 );
 
-      if ( m < val )
-	val = m;
-    }
+      if (m_keep_equivalence)
+	lower( val, found, p.profit_1, p.profit_2 );
 
-  // the last point
-  m = m_lambda_1 * ((profit_type)*first).profit_1
-    + m_lambda_2 * ((profit_type)*first).profit_2;
-      
-  if ( m < val )
-    val = m;
+      left = p.profit_1;
+    }
 
-  // the nadir on the right of the last point + (1,1)
-  m = m_lambda_1 * (((profit_type)*first).profit_1 + 1)
-    + m_lambda_2 * (m_bottom_right.profit_2 + 1);
+  // the nadir on the left of the bottom right point + (1,1)
+  lower( val, found, left + 1, m_bottom_right.profit_2 + 1 );
 
-  if ( m < val )
-    val = m;
+  if (m_keep_equivalence)
+    lower( val, found, m_bottom_right.profit_1, m_bottom_right.profit_2 );
 
-  // bottom right point
-  m = m_lambda_1 * m_bottom_right.profit_1
-    + m_lambda_2 * m_bottom_right.profit_2;
-  
-  if ( m < val )
-    val = m;
-  
   if (val > m_combined_min)
     m_combined_min = val;
-} // combined_triangle::tighten_keep()
+} // combined_triangle::tighten_staircase()
 
 /*----------------------------------------------------------------------------*/
 /**
  * \brief Reduce the region according to a set of points in the case where we
- *        do not keep equivalent solutions.
+ *        search an approximation of the front.
  *
- * The minimum combined objective of the solutions in the region is set equal to
- * or greater than the minimum combined objective value of the potential
- * solutions in the triangle, according to the set.
+ * A point p covers the points lower or equal to scale(p), so the minimum
+ * combined objective is the one of the nadirs of the staircase made by the
+ * scaled points and the scaled corners. The minimum is not greater than the
+ * combined objective of the points themselves, which must be found in the
+ * region.
  *
  * \param first Iterator on the first point in the set.
  * \param last Iterator past the last point in the set.
  */
 template<class Iterator>
-void combined_triangle::tighten_dont_keep( Iterator first, Iterator last )
+void combined_triangle::tighten_approximation( Iterator first, Iterator last )
 {
-  Iterator second(first);
+  const profit_type bottom = scale( m_bottom_right );
+  profit_type left = scale( m_top_left );
   real_type m, val;
-  
-  ++second;
-  
-  val = m_lambda_1 * (m_top_left.profit_1 + 1)
-    + m_lambda_2 * ( ((profit_type)*first).profit_2 + 1);
-  
-  for ( ; second != last; ++first, ++second)
+
+  // the corners
+  val = m_lambda_1 * m_top_left.profit_1 + m_lambda_2 * m_top_left.profit_2;
+
+  m = m_lambda_1 * m_bottom_right.profit_1
+    + m_lambda_2 * m_bottom_right.profit_2;
+
+  if ( m < val )
+    val = m;
+
+  for ( ; first != last; ++first )
     {
-      m = m_lambda_1 * ( ((profit_type)*first).profit_1 + 1) +
-	m_lambda_2 * ( ((profit_type)*second).profit_2 + 1);
-      
+      const profit_type p( *first );
+      const profit_type s( scale(p) );
+
+      // the point
+      m = m_lambda_1 * p.profit_1 + m_lambda_2 * p.profit_2;
+
       if ( m < val )
 	val = m;
+
+      // the nadir on the left of the scaled point + (1,1)
+      m = m_lambda_1 * (left.profit_1 + 1)
+	+ m_lambda_2 * (std::max(s.profit_2, bottom.profit_2) + 1);
+
+      if ( m < val )
+	val = m;
+
+      if ( s.profit_1 > left.profit_1 )
+	left = s;
     }
 
-  m = m_lambda_1 * ( ((profit_type)*first).profit_1 + 1) +
-    m_lambda_2 * (m_bottom_right.profit_2 + 1);
-  
+  // the nadir on the right of the last point + (1,1)
+  m = m_lambda_1 * (left.profit_1 + 1) + m_lambda_2 * (bottom.profit_2 + 1);
+
   if ( m < val )
     val = m;
-  
+
   if (val > m_combined_min)
     m_combined_min = val;
-} // combined_triangle::tighten_dont_keep()
+} // combined_triangle::tighten_approximation()
@@ -26,9 +26,16 @@
  */
 template<typename Problem>
 mono_relaxation<Problem>::mono_relaxation( const problem_type& p )
-  : m_mono(p)
+  : m_mono(p), m_profit_sum(p.size() + 1), m_weight_sum(p.size() + 1)
 {
+  m_profit_sum[0] = 0;
+  m_weight_sum[0] = 0;
 
+  for (unsigned int i=0; i!=p.size(); ++i)
+    {
+      m_profit_sum[i+1] = m_profit_sum[i] + (real_type)p.profit(i);
+      m_weight_sum[i+1] = m_weight_sum[i] + p.weight(i);
+    }
 } // mono_relaxation::mono_relaxation()
 
 /*----------------------------------------------------------------------------*/
@@ -44,7 +51,24 @@ bool mono_relaxation<Problem>::interesting
 ( const profit_type& profit, const profit_type& bound, unsigned int from_var,
   weight_type cap ) const
 {
-  return relax( profit, from_var, cap ) >= bound;
+  const unsigned int split = split_item( from_var, cap );
+  const weight_type remaining =
+    cap - (m_weight_sum[split] - m_weight_sum[from_var]);
+  const real_type z =
+    profit + m_profit_sum[split] - m_profit_sum[from_var];
+
+  if ( split == m_mono.size() )
+    return z >= bound;
+
+  // Dantzig
+  if ( z + remaining * (real_type)m_mono.profit(split) / m_mono.weight(split)
+       < bound )
+    return false;
+
+  // Martello & Toth
+  mono_relax lr;
+
+  return lr.calculate(m_mono, split, z, remaining).objective_value >= bound;
 } // mono_relaxation::interesting()
 
 /*----------------------------------------------------------------------------*/
@@ -59,7 +83,30 @@ real_type
 mono_relaxation<Problem>::relax
 ( real_type profit, unsigned int from_var, weight_type cap ) const
 {
+  const unsigned int split = split_item( from_var, cap );
   mono_relax lr;
-  return lr.calculate_from(m_mono, from_var, profit, cap).objective_value;
+
+  return lr.calculate
+    ( m_mono, split, profit + m_profit_sum[split] - m_profit_sum[from_var],
+      cap - (m_weight_sum[split] - m_weight_sum[from_var]) ).objective_value;
 } // mono_relaxation::relax()
 
+/*----------------------------------------------------------------------------*/
+/**
+ * \brief Get the first item that does not fit in the knapsack when the items
+ *        are added in order.
+ * \param from_var The index of the first item to add.
+ * \param cap The remaining capacity of the problem.
+ * \return m_mono.size() if all the items fit.
+ */
+template<typename Problem>
+unsigned int
+mono_relaxation<Problem>::split_item
+( unsigned int from_var, weight_type cap ) const
+{
+  const typename std::vector<weight_type>::const_iterator it =
+    std::upper_bound( m_weight_sum.begin() + from_var, m_weight_sum.end(),
+                      m_weight_sum[from_var] + cap );
+
+  return it - m_weight_sum.begin() - 1;
+} // mono_relaxation::split_item()
@@ -24,11 +24,19 @@
 
 #include "bikp/relaxation/mt_linear_relaxation.hpp"
 
+#include <algorithm>
+#include <vector>
+
 /**
  * \brief The mono_relaxation class compute an upper bound on the objective 
  *        of a mono objective problem using the Martello & Toth's improved
  *        linear relaxation.
  *
+ * The cumulated profits and weights of the items are computed once, so the
+ * split item is found by a binary search instead of adding the items one by
+ * one. interesting() checks the linear relaxation of Dantzig before the
+ * tighter bound of Martello & Toth.
+ *
  * \author Julien Jorge
  */
 template<typename Problem>
@@ -60,10 +68,22 @@ public:
   real_type
   relax( real_type profit, unsigned int from_var, weight_type cap ) const;
 
+private:
+  unsigned int
+  split_item( unsigned int from_var, weight_type cap ) const;
+
 private:
   /** \brief The bi-objective problem reduced to its mono objective. */
   mono_problem_type m_mono;
 
+  /** \brief The cumulated profit of the items, m_profit_sum[i] is the sum of
+      the profits of the items in [0, i). */
+  std::vector<real_type> m_profit_sum;
+
+  /** \brief The cumulated weight of the items, m_weight_sum[i] is the sum of
+      the weights of the items in [0, i). */
+  std::vector<weight_type> m_weight_sum;
+
 }; // mono_relaxation
 
 #include "bikp/relaxation/impl/mono_relaxation.tpp"
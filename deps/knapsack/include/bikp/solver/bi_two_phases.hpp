@@ -21,6 +21,7 @@
 #define __BIKP_BI_TWO_PHASES_HPP__
 
 #include "bikp/problem/bi_problem.hpp"
+#include "bikp/phase/base_second_phase.hpp"
 #include <list>
 
 /**
@@ -30,7 +31,20 @@
 class bi_two_phases
 {
 public:
+  /** \brief A triangle not explored before the time limit. */
+  typedef base_second_phase::triangle_gap triangle_gap;
+
+public:
+  explicit bi_two_phases( double epsilon = 0 );
+
   void run( const bi_problem& p, std::list<bi_solution>& sols ) const;
+  void run( const bi_problem& p, std::list<bi_solution>& sols,
+	    double time_limit, std::list<triangle_gap>& gaps ) const;
+
+private:
+  /** \brief The relative tolerance of the approximation of the front, zero
+      for the exact front. */
+  const double m_epsilon;
 
 }; // class bi_two_phases
 
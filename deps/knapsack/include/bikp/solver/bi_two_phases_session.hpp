@@ -0,0 +1,104 @@
+/*
+  Copyright Facult des Sciences et Techniques de Nantes
+  contributor:
+    Julien Jorge <julien.jorge@univ-nantes.fr>
+
+  This software is a computer program whose purpose is to exactly solve
+  instances of the bi-objective unidimensional 0-1 knapsack problem.
+
+  This software is governed by the CeCILL license under French law and
+  abiding by the rules of distribution of free software.  You can  use, 
+  modify and/ or redistribute the software under the terms of the CeCILL
+  license as circulated by CEA, CNRS and INRIA at the following URL
+  "http://www.cecill.info". 
+*/
+/**
+ * \file bi_two_phases_session.hpp
+ * \brief Solve a problem again after some small changes.
+ * \author Julien Jorge
+ */
+#ifndef __BIKP_BI_TWO_PHASES_SESSION_HPP__
+#define __BIKP_BI_TWO_PHASES_SESSION_HPP__
+
+#include "bikp/problem/bi_problem.hpp"
+#include <list>
+#include <vector>
+
+/**
+ * \brief The two phases algorithm on a problem modified between the
+ *        resolutions.
+ *
+ * The efficient solutions of the previous resolution that are still feasible
+ * are given to the second phase as known solutions, to tighten the bounds of
+ * the triangles. If the changes can only remove some feasible solutions or
+ * decrease the profits, the new efficient points are searched only under the
+ * previous points that have been lost, and the triangles with no such part are
+ * not explored.
+ *
+ * \author Julien Jorge
+ */
+class bi_two_phases_session
+{
+public:
+  bi_two_phases_session
+  ( int sz, const int* obj1, const int* obj2, const int* weigths,
+    int capacity );
+  ~bi_two_phases_session();
+
+  void set_capacity( int capacity );
+  void set_item( unsigned int i, int p1, int p2, int w );
+  void add_item( int p1, int p2, int w );
+  void remove_item( unsigned int i );
+
+  void run();
+
+  const bi_problem& get_problem() const;
+  const std::list<bi_solution>& get_solutions() const;
+
+private:
+  // not copyable, the solutions point to m_problem
+  bi_two_phases_session( const bi_two_phases_session& that );
+  bi_two_phases_session& operator=( const bi_two_phases_session& that );
+
+  void convert_solutions
+  ( const bi_problem& p, std::list<bi_solution>& seeds,
+    std::list<bi_profit>& lost ) const;
+  bool find_supported_solutions
+  ( const std::list<bi_solution>& seeds, const std::list<bi_profit>& lost,
+    std::list<bi_solution>& X_SE ) const;
+
+private:
+  /** \brief The profits of the items on the first objective. */
+  std::vector<int> m_profit_1;
+
+  /** \brief The profits of the items on the second objective. */
+  std::vector<int> m_profit_2;
+
+  /** \brief The weights of the items. */
+  std::vector<int> m_weight;
+
+  /** \brief The capacity of the knapsack. */
+  int m_capacity;
+
+  /** \brief For each item, its index in m_problem, or -1 if it has been
+      added since the last resolution. */
+  std::vector<int> m_previous_index;
+
+  /** \brief Tell if the changes since the last resolution may have added
+      some feasible solutions or increased some profits. */
+  bool m_relaxed;
+
+  /** \brief The problem of the last resolution, NULL before the first
+      one. */
+  bi_problem* m_problem;
+
+  /** \brief The efficient solutions of m_problem. */
+  std::list<bi_solution> m_solutions;
+
+  /** \brief The images of the supported solutions of m_problem, by
+      increasing profit on the first objective. */
+  std::list<bi_profit> m_supported;
+
+}; // class bi_two_phases_session
+
+#endif // __BIKP_BI_TWO_PHASES_SESSION_HPP__
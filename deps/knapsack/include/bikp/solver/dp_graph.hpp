@@ -27,6 +27,8 @@
 
 #include "bikp/tool/types.hpp"
 
+#include <moo/object_pool.hpp>
+
 /**
  * \brief A class that creates the dynamic programming table/graph of a knapsack
  *        problem.
@@ -85,6 +87,7 @@ private:
 			   std::queue<vertex_type*>& pending );
 
   void push_in_layer( vertex_type* v );
+  void remove_dominated( layer_type& layer );
 
   bool interesting( const upper_bound_type& ub, const problem_type& p,
 		    const vertex_type& v, const region_type& region ) const;
@@ -98,6 +101,9 @@ private:
     std::vector< std::map<weight_type, real_type> >& count_table ) const;
 
 private:
+  /** \brief The memory of the vertices. */
+  moo::object_pool<vertex_type> m_vertex_pool;
+
   /** \brief The layers in the graph. */
   std::vector<layer_type> m_layers;
 
@@ -55,6 +55,10 @@ public:
     typedef half_line<typename problem_type::profit_traits_type> region_type;
     typedef mono_relaxation<problem_type> relaxation_type;
     typedef vertex<problem_type> vertex_type;
+
+    /** \brief Only the paths of the best profit are searched, the vertices
+        dominated by a lighter one can be removed. */
+    static const bool dominance_pruning = true;
   }; // struct framework
 
 protected:
@@ -47,7 +47,7 @@ dp_graph<Framework>::~dp_graph()
 {
   for (unsigned int i=0; i!=m_layers.size(); ++i)
     for (unsigned int j=0; j!=m_layers[i].size(); ++j)
-      delete m_layers[i][j];
+      m_vertex_pool.destroy( m_layers[i][j] );
 } // dp_graph::~dp_graph()
 
 /*----------------------------------------------------------------------------*/
@@ -143,7 +143,7 @@ void dp_graph<Framework>::build_graph
 {
   upper_bound_type ub(p);
 
-  m_layers[0].push_back( new vertex_type(p) );
+  m_layers[0].push_back( new (m_vertex_pool.allocate()) vertex_type(p) );
 
   for (unsigned int i=0; i!=m_layers.size()-1; ++i)
     {
@@ -157,22 +157,24 @@ void dp_graph<Framework>::build_graph
 
 	  vertex_type& v = *m_layers[i][j];
 	  
-	  vertex_type* skip = new vertex_type( i + 1, v );
+	  vertex_type* skip =
+            new (m_vertex_pool.allocate()) vertex_type( i + 1, v );
 
 	  if ( interesting(ub, p, *skip, region) )
 	    insert_vertex_skip(skip, pending);
 	  else
-	    delete skip;
+	    m_vertex_pool.destroy(skip);
 
 	  if ( v.weight() + p.weight(i) <= p.capacity() )
 	    {
 	      vertex_type* keep =
-		new vertex_type( i + 1, v, p.weight(i), p.profit(i) );  
+		new (m_vertex_pool.allocate())
+                vertex_type( i + 1, v, p.weight(i), p.profit(i) );
 
 	      if ( interesting(ub, p, *keep, region) )
 		insert_vertex_keep(keep, pending);
 	      else
-		delete keep;
+		m_vertex_pool.destroy(keep);
 	    }
 
 	  v.done();
@@ -184,6 +186,9 @@ void dp_graph<Framework>::build_graph
 	  pending.pop();
 	}
 
+      if ( Framework::dominance_pruning )
+        remove_dominated( m_layers[i+1] );
+
       //std::cout << std::endl;
     }
 
@@ -248,12 +253,53 @@ void dp_graph<Framework>::push_in_layer( vertex_type* v )
   else if ( layer[ layer.size() - 1 ]->weight() == v->weight() )
     {
       layer[ layer.size() - 1 ]->amalgate(*v);
-      delete v;
+      m_vertex_pool.destroy(v);
     }
   else
     layer.push_back(v);
 } // dp_graph::push_in_layer()
 
+/*----------------------------------------------------------------------------*/
+/**
+ * \brief Remove from a layer the vertices whose best profit is strictly lower
+ *        than the one of a lighter vertex.
+ * \param layer (in/out) The layer, sorted by increasing weight.
+ *
+ * Any completion of the paths of such a vertex can be applied to the best
+ * path of the lighter vertex, for a strictly greater profit. The vertices
+ * having the same profit are kept, since their paths may lead to equivalent
+ * optimal solutions.
+ */
+template<class Framework>
+void dp_graph<Framework>::remove_dominated( layer_type& layer )
+{
+  if ( layer.empty() )
+    return;
+
+  real_type best_profit = (real_type)layer[0]->profit();
+  unsigned int n = 1;
+
+  for (unsigned int j=1; j!=layer.size(); ++j)
+    {
+      const real_type profit = (real_type)layer[j]->profit();
+
+      assert( layer[j-1]->weight() < layer[j]->weight() );
+
+      if ( profit < best_profit )
+	m_vertex_pool.destroy( layer[j] );
+      else
+	{
+	  layer[n] = layer[j];
+	  ++n;
+
+	  if ( profit > best_profit )
+	    best_profit = profit;
+	}
+    }
+
+  layer.resize(n);
+} // dp_graph::remove_dominated()
+
 /*----------------------------------------------------------------------------*/
 /**
  * \brief Tell if it's interesting to build the graph after a given vertex.
@@ -22,6 +22,9 @@
 
 #include <list>
 #include <map>
+#include <vector>
+
+#include <moo/object_pool.hpp>
 #include "bikp/concept/minimum_complete_set.hpp"
 #include "bikp/concept/pareto_set.hpp"
 #include "bikp/problem/combined_problem.hpp"
@@ -33,6 +36,10 @@
 
 /**
  * \brief An algorithm that builds the k best-solutions of a knapsack problem.
+ *
+ * The paths and their sets of turning vertices are allocated in pools owned
+ * by the instance.
+ *
  * \author Julien Jorge.
  */
 class k_longest_paths
@@ -53,6 +60,10 @@ private:
     typedef combined_triangle_front region_type;
     typedef mono_relaxation<problem_type> relaxation_type;
     typedef vertex<problem_type> vertex_type;
+
+    /** \brief The paths of lower profit are searched too, all the vertices
+        must be kept. */
+    static const bool dominance_pruning = false;
   }; // struct framework
 
   /** \brief The type of the graph representation. */
@@ -72,18 +83,16 @@ private:
     typedef std::list<const_vertex_ptr> set_type;
 
   public:
-    vertex_set( const vertex_set* that, const vertex_type& v );
+    vertex_set( vertex_set* that, const vertex_type& v );
 
     void get_vertices( set_type& vertices ) const;
     const vertex_type& last_vertex() const;
+    vertex_set* parent() const;
 
-    void release();
+    bool remove_link();
 
   private:
     void add_link();
-    void remove_link();
-
-    ~vertex_set();
 
   private:
     /** \brief The number of link to this set (ie. the number of sets containing
@@ -92,7 +101,7 @@ private:
 
     /** \brief The edges in this set. This value is shared between the
 	instances. */
-    const vertex_set* m_parent;
+    vertex_set* m_parent;
 
     /** \brief The edge that make this set different of its parent. */
     const vertex_type& m_turning;
@@ -109,18 +118,14 @@ private:
   {
   public:
     path( const vertex_type& r );
-    path( const path& that, const vertex_type& t, const combined_profit& p );
-    ~path();
+    path( const path& that, vertex_set* s, const combined_profit& p );
 
     void get_vertices( std::list<const_vertex_ptr>& vertices ) const;
 
     const combined_profit& profit() const;
     const vertex_type& root() const;
     const vertex_type& last_vertex() const;
-
-    static unsigned int inst_count;
-    static unsigned int inst_count_max;
-    static unsigned int current;
+    vertex_set* vertices() const;
 
   private:
     /** \brief The out-vertices in the path (vertices that are not on the
@@ -135,8 +140,9 @@ private:
 
   }; // class path
 
-  /** \brief The container use for storing paths. */
-  typedef std::list<path*> quality_table_value_type;
+  /** \brief The container use for storing paths. It is used as a stack: the
+      next path to explore is at the back. */
+  typedef std::vector<path*> quality_table_value_type;
 
   /** \brief The type of the table containing paths for each solution
       quality. */
@@ -171,6 +177,11 @@ private:
   void add_path( const path& p, const_vertex_ptr s, const_vertex_ptr t );
   void clear_table();
 
+  path* new_path( const vertex_type& r );
+  path* new_path
+  ( const path& that, const vertex_type& t, const combined_profit& p );
+  void delete_path( path* p );
+
   void set_solution_variable
   ( unsigned int i, combined_solution& sol, bool in ) const;
 
@@ -203,6 +214,12 @@ private:
       paths. */
   combined_triangle_front m_paths_region;
 
+  /** \brief The memory of the sets of turning vertices. */
+  moo::object_pool<vertex_set> m_vertex_set_pool;
+
+  /** \brief The memory of the paths. */
+  moo::object_pool<path> m_path_pool;
+
 }; // class k_longest_paths
 
 #endif // __BIKP_K_LONGEST_PATHS_HPP__
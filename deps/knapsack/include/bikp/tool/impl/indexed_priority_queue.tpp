@@ -0,0 +1,249 @@
+/*
+  Copyright Faculté des Sciences et Techniques de Nantes
+  contributor:
+    Julien Jorge <julien.jorge@univ-nantes.fr>
+
+  This software is a computer program whose purpose is to exactly solve
+  instances of the bi-objective unidimensional 0-1 knapsack problem.
+
+  This software is governed by the CeCILL license under French law and
+  abiding by the rules of distribution of free software.  You can  use, 
+  modify and/ or redistribute the software under the terms of the CeCILL
+  license as circulated by CEA, CNRS and INRIA at the following URL
+  "http://www.cecill.info". 
+*/
+/**
+ * \file indexed_priority_queue.tpp
+ * \brief Implementation of the tool::indexed_priority_queue class.
+ * \author Julien Jorge
+ */
+#include <cassert>
+
+/*----------------------------------------------------------------------------*/
+/**
+ * \brief Constructor.
+ * \param size The number of items that can be inserted in the queue.
+ */
+template<typename Key, typename Compare>
+tool::indexed_priority_queue<Key, Compare>::indexed_priority_queue
+( std::size_t size )
+  : m_position(size, size), m_key(size)
+{
+  m_heap.reserve(size);
+} // indexed_priority_queue::indexed_priority_queue()
+
+/*----------------------------------------------------------------------------*/
+/**
+ * \brief Tell if the queue is empty.
+ */
+template<typename Key, typename Compare>
+bool tool::indexed_priority_queue<Key, Compare>::empty() const
+{
+  return m_heap.empty();
+} // indexed_priority_queue::empty()
+
+/*----------------------------------------------------------------------------*/
+/**
+ * \brief Get the number of items in the queue.
+ */
+template<typename Key, typename Compare>
+std::size_t tool::indexed_priority_queue<Key, Compare>::size() const
+{
+  return m_heap.size();
+} // indexed_priority_queue::size()
+
+/*----------------------------------------------------------------------------*/
+/**
+ * \brief Tell if an item is in the queue.
+ * \param i The item.
+ */
+template<typename Key, typename Compare>
+bool tool::indexed_priority_queue<Key, Compare>::contains( std::size_t i ) const
+{
+  assert( i < m_position.size() );
+
+  return m_position[i] < m_heap.size();
+} // indexed_priority_queue::contains()
+
+/*----------------------------------------------------------------------------*/
+/**
+ * \brief Insert an item in the queue.
+ * \param i The item.
+ * \param k The key of the item.
+ * \pre !contains(i)
+ */
+template<typename Key, typename Compare>
+void tool::indexed_priority_queue<Key, Compare>::push
+( std::size_t i, const key_type& k )
+{
+  assert( !contains(i) );
+
+  m_key[i] = k;
+  m_heap.push_back(i);
+  m_position[i] = m_heap.size() - 1;
+
+  sift_up( m_heap.size() - 1 );
+} // indexed_priority_queue::push()
+
+/*----------------------------------------------------------------------------*/
+/**
+ * \brief Get the item with the best key.
+ * \pre !empty()
+ */
+template<typename Key, typename Compare>
+std::size_t tool::indexed_priority_queue<Key, Compare>::top() const
+{
+  assert( !empty() );
+
+  return m_heap.front();
+} // indexed_priority_queue::top()
+
+/*----------------------------------------------------------------------------*/
+/**
+ * \brief Remove the item with the best key.
+ * \pre !empty()
+ */
+template<typename Key, typename Compare>
+void tool::indexed_priority_queue<Key, Compare>::pop()
+{
+  assert( !empty() );
+
+  const std::size_t i = m_heap.front();
+  const std::size_t last = m_heap.back();
+
+  m_heap.pop_back();
+  m_position[i] = m_position.size();
+
+  if ( !m_heap.empty() )
+    {
+      place( 0, last );
+      sift_down( 0 );
+    }
+} // indexed_priority_queue::pop()
+
+/*----------------------------------------------------------------------------*/
+/**
+ * \brief Get the key of an item.
+ * \param i The item.
+ */
+template<typename Key, typename Compare>
+const typename tool::indexed_priority_queue<Key, Compare>::key_type&
+tool::indexed_priority_queue<Key, Compare>::key( std::size_t i ) const
+{
+  assert( i < m_key.size() );
+
+  return m_key[i];
+} // indexed_priority_queue::key()
+
+/*----------------------------------------------------------------------------*/
+/**
+ * \brief Change the key of an item of the queue.
+ * \param i The item.
+ * \param k The new key of the item.
+ * \pre contains(i)
+ */
+template<typename Key, typename Compare>
+void tool::indexed_priority_queue<Key, Compare>::change_key
+( std::size_t i, const key_type& k )
+{
+  assert( contains(i) );
+
+  const bool better = m_compare( k, m_key[i] );
+
+  m_key[i] = k;
+
+  if ( better )
+    sift_up( m_position[i] );
+  else
+    sift_down( m_position[i] );
+} // indexed_priority_queue::change_key()
+
+/*----------------------------------------------------------------------------*/
+/**
+ * \brief Tell if an item must be before an other one in the queue.
+ * \param a The first item.
+ * \param b The second item.
+ */
+template<typename Key, typename Compare>
+bool tool::indexed_priority_queue<Key, Compare>::before
+( std::size_t a, std::size_t b ) const
+{
+  if ( m_compare( m_key[a], m_key[b] ) )
+    return true;
+  else if ( m_compare( m_key[b], m_key[a] ) )
+    return false;
+  else
+    return a > b;
+} // indexed_priority_queue::before()
+
+/*----------------------------------------------------------------------------*/
+/**
+ * \brief Put an item at a given position in the heap.
+ * \param position The position in the heap.
+ * \param i The item.
+ */
+template<typename Key, typename Compare>
+void tool::indexed_priority_queue<Key, Compare>::place
+( std::size_t position, std::size_t i )
+{
+  m_heap[position] = i;
+  m_position[i] = position;
+} // indexed_priority_queue::place()
+
+/*----------------------------------------------------------------------------*/
+/**
+ * \brief Move an item toward the top of the heap until its parent is before
+ *        it.
+ * \param position The position of the item in the heap.
+ */
+template<typename Key, typename Compare>
+void tool::indexed_priority_queue<Key, Compare>::sift_up( std::size_t position )
+{
+  const std::size_t i = m_heap[position];
+
+  while ( (position > 0) && before( i, m_heap[(position - 1) / 2] ) )
+    {
+      place( position, m_heap[(position - 1) / 2] );
+      position = (position - 1) / 2;
+    }
+
+  place( position, i );
+} // indexed_priority_queue::sift_up()
+
+/*----------------------------------------------------------------------------*/
+/**
+ * \brief Move an item toward the bottom of the heap until it is before its
+ *        children.
+ * \param position The position of the item in the heap.
+ */
+template<typename Key, typename Compare>
+void
+tool::indexed_priority_queue<Key, Compare>::sift_down( std::size_t position )
+{
+  const std::size_t i = m_heap[position];
+  bool stop = false;
+
+  while ( !stop )
+    {
+      std::size_t child = 2 * position + 1;
+
+      if ( child >= m_heap.size() )
+	stop = true;
+      else
+	{
+	  if ( (child + 1 < m_heap.size())
+	       && before( m_heap[child + 1], m_heap[child] ) )
+	    ++child;
+
+	  if ( before( m_heap[child], i ) )
+	    {
+	      place( position, m_heap[child] );
+	      position = child;
+	    }
+	  else
+	    stop = true;
+	}
+    }
+
+  place( position, i );
+} // indexed_priority_queue::sift_down()
@@ -0,0 +1,95 @@
+/*
+  Copyright Faculté des Sciences et Techniques de Nantes
+  contributor:
+    Julien Jorge <julien.jorge@univ-nantes.fr>
+
+  This software is a computer program whose purpose is to exactly solve
+  instances of the bi-objective unidimensional 0-1 knapsack problem.
+
+  This software is governed by the CeCILL license under French law and
+  abiding by the rules of distribution of free software.  You can  use, 
+  modify and/ or redistribute the software under the terms of the CeCILL
+  license as circulated by CEA, CNRS and INRIA at the following URL
+  "http://www.cecill.info". 
+*/
+/**
+ * \file indexed_priority_queue.hpp
+ * \brief A priority queue of indices whose keys can be changed.
+ * \author Julien Jorge
+ */
+#ifndef __BIKP_TOOL_INDEXED_PRIORITY_QUEUE_HPP__
+#define __BIKP_TOOL_INDEXED_PRIORITY_QUEUE_HPP__
+
+#include <functional>
+#include <vector>
+
+namespace tool
+{
+  /**
+   * \brief A priority queue of indices whose keys can be changed.
+   *
+   * The items are the integers in [0, size), each one being associated with a
+   * key. The item on the top of the queue is the one with the best key
+   * according to Compare; two items with equivalent keys are ordered by
+   * decreasing index. The queue is a binary heap with the position of each
+   * item, so the key of an item in the queue can be changed in logarithmic
+   * time.
+   *
+   * \b Template \b parameters:
+   * - \a Key The type of the keys,
+   * - \a Compare A function object such that Compare(a, b) is true if \a a
+   *   is a better key than \a b.
+   *
+   * \author Julien Jorge
+   */
+  template< typename Key, typename Compare = std::less<Key> >
+  class indexed_priority_queue
+  {
+  public:
+    /** \brief The type of the keys. */
+    typedef Key key_type;
+
+    /** \brief The type of the function object that compares the keys. */
+    typedef Compare key_compare;
+
+  public:
+    explicit indexed_priority_queue( std::size_t size );
+
+    bool empty() const;
+    std::size_t size() const;
+    bool contains( std::size_t i ) const;
+
+    void push( std::size_t i, const key_type& k );
+    std::size_t top() const;
+    void pop();
+
+    const key_type& key( std::size_t i ) const;
+    void change_key( std::size_t i, const key_type& k );
+
+  private:
+    bool before( std::size_t a, std::size_t b ) const;
+    void place( std::size_t position, std::size_t i );
+
+    void sift_up( std::size_t position );
+    void sift_down( std::size_t position );
+
+  private:
+    /** \brief The position in m_heap of each item, m_heap.size() if the item
+        is not in the queue. */
+    std::vector<std::size_t> m_position;
+
+    /** \brief The key of each item. */
+    std::vector<key_type> m_key;
+
+    /** \brief The items in the queue, as a binary heap. */
+    std::vector<std::size_t> m_heap;
+
+    /** \brief The function object that compares the keys. */
+    key_compare m_compare;
+
+  }; // class indexed_priority_queue
+} // namespace tool
+
+#include "bikp/tool/impl/indexed_priority_queue.tpp"
+
+#endif // __BIKP_TOOL_INDEXED_PRIORITY_QUEUE_HPP__
@@ -20,6 +20,8 @@
 #ifndef __BIKP_SECOND_ITERATOR_HPP__
 #define __BIKP_SECOND_ITERATOR_HPP__
 
+#include <iterator>
+
 template<class MapIterator>
 class const_second_iterator
 {
@@ -30,6 +32,11 @@ public:
   typedef const value_type& const_reference;
   typedef const value_type* const_pointer;
 
+  typedef std::bidirectional_iterator_tag iterator_category;
+  typedef typename iterator_type::difference_type difference_type;
+  typedef const_reference reference;
+  typedef const_pointer pointer;
+
   typedef const_second_iterator<iterator_type> self_type;
 
 public:
@@ -19,6 +19,11 @@ namespace kp
 {
   /**
    * \brief A multi-objective branch and bound for the knapsack problem.
+   *
+   * The nodes are evaluated by OpenMP tasks, one for each node pushed in the
+   * queue of the pending nodes. The tasks share this queue and the
+   * solution_data.
+   *
    * \author Julien Jorge
    */
   class astar
@@ -133,6 +138,8 @@ namespace kp
       int compare_max( std::size_t a, std::size_t b ) const;
     }; // class node_comparator
 
+    class search;
+
   private:
     typedef std::list<node*>::iterator candidate_iterator_type;
     typedef std::list<candidate_iterator_type> candidate_list_type;
@@ -144,9 +151,6 @@ namespace kp
     ( const knapsack_instance& inst, maximum_set& X,
       int o = order_on_items::order_topological );
 
-  private:
-    void update_nb_dominated_solutions( queue_type& pending );
-
   }; // class astar
 } // namespace kp
 
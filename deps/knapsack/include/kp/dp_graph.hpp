@@ -27,6 +27,8 @@
 #include <kp/bounded_region.hpp>
 #include <kp/vertex.hpp>
 
+#include <moo/object_pool.hpp>
+
 #include <bikp/problem/mono_problem.hpp>
 
 namespace kp
@@ -60,6 +62,12 @@ namespace kp
   private:
     void build_graph( const view_type& p, const bounded_region& region );
 
+    vertex* new_vertex( unsigned int p );
+    vertex* new_vertex( unsigned int index, const vertex& that );
+    vertex* new_vertex
+    ( unsigned int index, const vertex& that, const variable& v );
+    void delete_vertex( vertex* v );
+
     void insert_vertex_skip
     ( vertex* skip, std::queue<vertex*>& pending, const cost_vector& dir );
     void insert_vertex_keep( vertex* keep, std::queue<vertex*>& pending );
@@ -71,6 +79,9 @@ namespace kp
       const bounded_region& region ) const;
   
   private:
+    /** \brief The memory of the vertices. */
+    moo::object_pool<vertex> m_vertex_pool;
+
     /** \brief The layers in the graph. */
     std::vector<layer_type> m_layers;
 
@@ -9,18 +9,112 @@
 #include <kp/knapsack_instance.hpp>
 #include <kp/types.hpp>
 
+#include <vector>
+
 namespace kp
 {
   /**
    * \brief A dynamic programming algorithm for the knapsack problem.
+   *
+   * This is the algorithm of Nemhauser and Ullmann: the states are kept in a
+   * list sorted by increasing weight and the list of the next item is the
+   * merge of the current list with its translation by the item, in which the
+   * dominated states are removed on the fly. The memory does not depend on
+   * the capacity.
+   *
+   * With an approximation ratio \f$\epsilon > 0\f$, a state is removed as
+   * soon as the upper bound of its completions is covered by a known feasible
+   * point multiplied by \f$1+\epsilon\f$, and these feasible points are
+   * returned with the remaining states. Every efficient point is then covered
+   * by a returned point multiplied by \f$1+\epsilon\f$.
+   *
    * \author Julien Jorge
    */
   class dynamic_programming
   {
+  private:
+    /** \brief A partial solution built by the algorithm. */
+    struct state
+    {
+      /** \brief The weight of the items in the knapsack. */
+      moo::real_type weight;
+
+      /** \brief The profit of the items in the knapsack. */
+      cost_vector profit;
+
+    }; // struct state
+
+    /** \brief The origin of a state, to build the solutions. */
+    struct trace
+    {
+      /** \brief The index of the state in the list of the previous item. */
+      std::size_t parent;
+
+      /** \brief Tell if the item has been put in the knapsack. */
+      bool set;
+
+    }; // struct trace
+
+    /** \brief A feasible point found by completing a state. */
+    struct bound_point
+    {
+      /** \brief The profit of the point. */
+      cost_vector profit;
+
+      /** \brief The items in the knapsack, only kept when the point may be
+          returned as a solution. */
+      std::vector<unsigned int> items;
+
+    }; // struct bound_point
+
+    typedef std::vector<state> state_list;
+    typedef std::vector< std::vector<trace> > trace_list;
+    typedef std::vector<bound_point> bound_list;
+
   public:
+    explicit dynamic_programming
+    ( bool bound_pruning = false, double epsilon = 0 );
+
     void solve( const knapsack_instance& inst, pareto_set& Z ) const;
     void solve( const knapsack_instance& inst, minimum_set& Z ) const;
 
+  private:
+    void run
+    ( const knapsack_instance& inst, std::vector<unsigned int>& order,
+      state_list& states, trace_list* traces, bound_list& lower_bounds ) const;
+
+    void merge
+    ( const state_list& states, const variable& v, moo::real_type capacity,
+      state_list& result, std::vector<trace>* traces ) const;
+
+    void sort_items
+    ( const knapsack_instance& inst, std::vector<unsigned int>& order ) const;
+
+    void prune
+    ( const knapsack_instance& inst, const std::vector<unsigned int>& order,
+      unsigned int next, state_list& states, trace_list* traces,
+      bound_list& lower_bounds ) const;
+
+    static void trace_items
+    ( const trace_list& traces, const std::vector<unsigned int>& order,
+      std::size_t s, std::vector<unsigned int>& items );
+    static knapsack_solution make_solution
+    ( const knapsack_instance& inst, const std::vector<unsigned int>& items );
+
+    static bool add_lower_bound
+    ( bound_list& lower_bounds, const cost_vector& lb );
+    static bool covers( const cost_vector& a, const cost_vector& b );
+    static bool covers
+    ( const cost_vector& a, const cost_vector& b, double ratio );
+
+  private:
+    /** \brief Tell if the states are pruned with an upper bound. */
+    const bool m_bound_pruning;
+
+    /** \brief The approximation ratio of the computed points. Zero for an
+        exact resolution. */
+    const double m_epsilon;
+
   }; // class dynamic_programming
 } // namespace kp
 
@@ -17,6 +17,7 @@
  * \brief Implementation of the dp_graph class.
  * \author Julien Jorge.
  */
+#include <algorithm>
 #include <fstream>
 #include <iostream>
 #include <set>
@@ -47,7 +48,7 @@ kp::dp_graph<View>::~dp_graph()
 {
   for (unsigned int i=0; i!=m_layers.size(); ++i)
     for (unsigned int j=0; j!=m_layers[i].size(); ++j)
-      delete m_layers[i][j];
+      delete_vertex( m_layers[i][j] );
 } // dp_graph::~dp_graph()
 
 /*----------------------------------------------------------------------------*/
@@ -80,33 +81,35 @@ void kp::dp_graph<View>::build_graph
       ( j, p.get_variable(j).cost.scalar_product(region.get_direction()),
         p.get_variable(j).weight );
 
-  m_layers[0].push_back( new vertex(p.get_nb_objectives()) );
+  m_layers[0].push_back( new_vertex(p.get_nb_objectives()) );
+
+  relax_cache_type relax_cache(p.get_capacity()+1);
 
   for (unsigned int i=0; i!=m_layers.size()-1; ++i)
     {
       std::queue<vertex*> pending;
-      relax_cache_type relax_cache(p.get_capacity()+1, -1);
+      std::fill( relax_cache.begin(), relax_cache.end(), -1 );
 
       for (unsigned int j=0; j!=m_layers[i].size(); ++j)
         {
           vertex& v = *m_layers[i][j];
-          vertex* skip = new vertex( i + 1, v );
+          vertex* skip = new_vertex( i + 1, v );
 
           if ( interesting(relax_cache, mono, *skip, region) )
             insert_vertex_skip(skip, pending, region.get_direction());
           else
-            delete skip;
+            delete_vertex(skip);
 
           const variable& var = p.get_variable(i);
 
           if ( v.weight() + var.weight <= p.get_capacity() )
             {
-              vertex* keep = new vertex( i + 1, v, var );
+              vertex* keep = new_vertex( i + 1, v, var );
 
               if ( interesting(relax_cache, mono, *keep, region) )
                 insert_vertex_keep(keep, pending);
               else
-                delete keep;
+                delete_vertex(keep);
             }
 
           v.done();
@@ -120,6 +123,55 @@ void kp::dp_graph<View>::build_graph
     }
 } // dp_graph::build_graph()
 
+/*----------------------------------------------------------------------------*/
+/**
+ * \brief Create the root vertex.
+ * \param p The number of objectives.
+ */
+template<class View>
+kp::vertex* kp::dp_graph<View>::new_vertex( unsigned int p )
+{
+  return new (m_vertex_pool.allocate()) vertex(p);
+} // dp_graph::new_vertex()
+
+/*----------------------------------------------------------------------------*/
+/**
+ * \brief Create a vertex made by skipping the variable of its parent.
+ * \param index The index of the layer of the vertex.
+ * \param that The parent vertex.
+ */
+template<class View>
+kp::vertex*
+kp::dp_graph<View>::new_vertex( unsigned int index, const vertex& that )
+{
+  return new (m_vertex_pool.allocate()) vertex(index, that);
+} // dp_graph::new_vertex()
+
+/*----------------------------------------------------------------------------*/
+/**
+ * \brief Create a vertex made by taking the variable of its parent.
+ * \param index The index of the layer of the vertex.
+ * \param that The parent vertex.
+ * \param v The variable taken.
+ */
+template<class View>
+kp::vertex* kp::dp_graph<View>::new_vertex
+( unsigned int index, const vertex& that, const variable& v )
+{
+  return new (m_vertex_pool.allocate()) vertex(index, that, v);
+} // dp_graph::new_vertex()
+
+/*----------------------------------------------------------------------------*/
+/**
+ * \brief Delete a vertex created with new_vertex().
+ * \param v The vertex to delete.
+ */
+template<class View>
+void kp::dp_graph<View>::delete_vertex( vertex* v )
+{
+  m_vertex_pool.destroy(v);
+} // dp_graph::delete_vertex()
+
 /*----------------------------------------------------------------------------*/
 /**
  * \brief Add a vertex in the graph, the vertex is made by skiping the variable
@@ -182,7 +234,7 @@ void kp::dp_graph<View>::push_in_layer( vertex* v, const cost_vector& dir )
         layer[ layer.size() - 1 ]->profit().scalar_product(dir);
 
       layer[ layer.size() - 1 ]->amalgate(*v, v_mono > s_mono );
-      delete v;
+      delete_vertex(v);
     }
   else
     layer.push_back(v);
@@ -12,6 +12,9 @@
 #include <bikp/reduction/simple_variable_fixing.hpp>
 
 #include <sstream>
+#include <vector>
+
+#include <omp.h>
 
 /*----------------------------------------------------------------------------*/
 /**
@@ -20,7 +23,7 @@
  */
 template<typename View>
 kp::phase_1<View>::phase_1( const view_type& inst )
-  : m_kp(inst)
+  : m_kp(inst), m_bicriteria_cache_hits(0), m_bicriteria_cache_misses(0)
 {
 
 } // phase_1::phase_1()
@@ -56,6 +59,28 @@ kp::phase_1<View>::get_hull() const
   return m_hull;
 } // phase_1::get_hull()
 
+/*----------------------------------------------------------------------------*/
+/**
+ * \brief Get the number of explored facets whose bi-objective problem was
+ *        already solved, during the last run.
+ */
+template<typename View>
+std::size_t kp::phase_1<View>::get_bicriteria_cache_hits() const
+{
+  return m_bicriteria_cache_hits;
+} // phase_1::get_bicriteria_cache_hits()
+
+/*----------------------------------------------------------------------------*/
+/**
+ * \brief Get the number of explored facets whose bi-objective problem had to
+ *        be solved, during the last run.
+ */
+template<typename View>
+std::size_t kp::phase_1<View>::get_bicriteria_cache_misses() const
+{
+  return m_bicriteria_cache_misses;
+} // phase_1::get_bicriteria_cache_misses()
+
 /*----------------------------------------------------------------------------*/
 /**
  * \brief Compute the coordinates of supported efficient solutions.
@@ -67,6 +92,9 @@ void kp::phase_1<View>::run()
   m_XSEM.clear();
   m_adjacent.clear();
   m_potentially_adjacent.clear();
+  m_bicriteria_cache.clear();
+  m_bicriteria_cache_hits = 0;
+  m_bicriteria_cache_misses = 0;
 
   lexicographic_optimal();
 
@@ -89,20 +117,26 @@ void kp::phase_1<View>::run()
                             neighbor)
                   == m_potentially_adjacent[y].end() );
 
-          std::list<knapsack_solution> X;
           neighbor_type f( choose_facet(w_p, neighbor) );
-          cost_vector lambda_1(3, 0);
-          cost_vector lambda_2(3, 0);
+          cost_vector lambda_1;
+          cost_vector lambda_2;
+          std::list<knapsack_solution> X;
 
-          lambda_1[0] = f.second.p[0][0];
-          lambda_1[1] = f.second.p[0][1];
-          lambda_1[2] = 1.0 - lambda_1[1] - lambda_1[0];
+          facet_weights(f, lambda_1, lambda_2);
 
-          lambda_2[0] = f.second.p[1][0];
-          lambda_2[1] = f.second.p[1][1];
-          lambda_2[2] = 1.0 - lambda_2[1] - lambda_2[0];
+          if ( take_cached_solutions(lambda_1, lambda_2, X) )
+            ++m_bicriteria_cache_hits;
+          else
+            {
+              ++m_bicriteria_cache_misses;
+
+              m_potentially_adjacent[y].push_front(neighbor);
+              solve_next_facets(w_p);
+              m_potentially_adjacent[y].pop_front();
+
+              take_cached_solutions(lambda_1, lambda_2, X);
+            }
 
-          bicriteria_solver(lambda_1, lambda_2, X);
           update_adjacency(lambda_1, lambda_2, X, y, f);
           update_polytope(X, w_p);
 
@@ -199,6 +233,100 @@ void kp::phase_1<View>::rebuild_potentially_adjacents( weight_set_type& w_p )
       }
 } // phase_1::rebuild_potentially_adjacents()
 
+/*----------------------------------------------------------------------------*/
+/**
+ * \brief Get the weights of the objectives at the bounds of a facet of the
+ *        weight set.
+ * \param f The facet.
+ * \param lambda_1 (out) The weights at the first bound.
+ * \param lambda_2 (out) The weights at the second bound.
+ */
+template<typename View>
+void kp::phase_1<View>::facet_weights
+( const neighbor_type& f, cost_vector& lambda_1, cost_vector& lambda_2 ) const
+{
+  lambda_1 = cost_vector(3, 0);
+  lambda_2 = cost_vector(3, 0);
+
+  lambda_1[0] = f.second.p[0][0];
+  lambda_1[1] = f.second.p[0][1];
+  lambda_1[2] = 1.0 - lambda_1[1] - lambda_1[0];
+
+  lambda_2[0] = f.second.p[1][0];
+  lambda_2[1] = f.second.p[1][1];
+  lambda_2[2] = 1.0 - lambda_2[1] - lambda_2[0];
+} // phase_1::facet_weights()
+
+/*----------------------------------------------------------------------------*/
+/**
+ * \brief Solve the bi-objective problems of the facets of a polytope leading
+ *        to the next potentially adjacent points, as many as there are
+ *        threads, and store their solutions in the cache. Only one problem
+ *        is solved when called from a parallel region, like the tasks of
+ *        mobb, since the nested loop would run on a single thread anyway.
+ * \param w_p The polytope.
+ */
+template<typename View>
+void kp::phase_1<View>::solve_next_facets( const weight_set_type& w_p )
+{
+  const std::list<cost_vector>& candidates =
+    m_potentially_adjacent[w_p.get_point()];
+  const std::size_t count = omp_in_parallel() ? 1 : omp_get_max_threads();
+  std::vector<bicriteria_key> lambda;
+  std::list<cost_vector>::const_iterator it;
+
+  for ( it=candidates.begin();
+        (it!=candidates.end()) && (lambda.size() != count); ++it )
+    {
+      cost_vector lambda_1;
+      cost_vector lambda_2;
+
+      facet_weights( choose_facet(w_p, *it), lambda_1, lambda_2 );
+
+      const bicriteria_key l( lambda_1, lambda_2 );
+
+      if ( (m_bicriteria_cache.find(l) == m_bicriteria_cache.end())
+           && (std::find(lambda.begin(), lambda.end(), l) == lambda.end()) )
+        lambda.push_back(l);
+    }
+
+  const long n = lambda.size();
+  std::vector< std::list<knapsack_solution> > X(n);
+
+#pragma omp parallel for schedule(dynamic, 1) if (n > 1)
+  for (long i=0; i<n; ++i)
+    bicriteria_solver( lambda[i].first, lambda[i].second, X[i] );
+
+  for (long i=0; i!=n; ++i)
+    m_bicriteria_cache[lambda[i]].swap(X[i]);
+} // phase_1::solve_next_facets()
+
+/*----------------------------------------------------------------------------*/
+/**
+ * \brief Get the solutions of a bi-objective problem from the cache and remove
+ *        them from it.
+ * \param lambda_1 The coefficients of the combination of the first objective.
+ * \param lambda_2 The coefficients of the combination of the second objective.
+ * \param X (out) The solutions, as bicriteria_solver() would compute them.
+ * \return false if the problem has not been solved yet.
+ */
+template<typename View>
+bool kp::phase_1<View>::take_cached_solutions
+( const cost_vector& lambda_1, const cost_vector& lambda_2,
+  std::list<knapsack_solution>& X )
+{
+  const typename bicriteria_cache_type::iterator it =
+    m_bicriteria_cache.find( bicriteria_key(lambda_1, lambda_2) );
+
+  if ( it == m_bicriteria_cache.end() )
+    return false;
+
+  X.swap( it->second );
+  m_bicriteria_cache.erase(it);
+
+  return true;
+} // phase_1::take_cached_solutions()
+
 /*----------------------------------------------------------------------------*/
 /**
  * \brief Compute the coordinates of the lexicographic optimal solutions.
@@ -464,28 +592,35 @@ bool kp::phase_1<View>::make_lambda
 template<typename View>
 void kp::phase_1<View>::find_equivalent_solutions()
 {
-  std::set<knapsack_solution> result( m_XSEm.begin(), m_XSEm.end() );
-  typename std::set<constraint_type>::const_iterator it;
+  const std::vector<constraint_type> hull( m_hull.begin(), m_hull.end() );
+  const long n = hull.size();
+  std::vector< std::list<knapsack_solution> > facet_sols(n);
 
-  for (it=m_hull.begin(); it!=m_hull.end(); ++it)
+  // the facets are independent, their solutions are merged in order below
+#pragma omp parallel for schedule(dynamic, 1) if (n > 1)
+  for (long f=0; f<n; ++f)
     {
+      const constraint_type& h = hull[f];
+
       mono_problem mono_p(m_kp.get_size(), m_kp.get_capacity());
 
       for (std::size_t i=0; i!=m_kp.get_size(); ++i)
         {
           const variable var(m_kp.get_variable(i));
           mono_p.set_variable
-            (i, var.cost.scalar_product(it->get_coefficient()), var.weight);
+            (i, var.cost.scalar_product(h.get_coefficient()), var.weight);
         }
       mono_p.sort_by_decreasing_efficiency();
-      simple_variable_fixing red(mono_p, it->get_right_hand_side());
+      simple_variable_fixing red(mono_p, h.get_right_hand_side());
 
+#if 0
       std::cout << "Fixing " << red.set_variables().size()
                 << " variables to one, " << red.unset_variables().size()
                 << " to zero ("
                 << ( m_kp.get_size() - red.set_variables().size()
                      - red.unset_variables().size() ) << '/' << m_kp.get_size()
                 << " remaining)." << std::endl;
+#endif
 
       // get the guaranteed profit and compute the remaining capacity
       std::vector<std::size_t> keep, fix_0, fix_1;
@@ -510,9 +645,9 @@ void kp::phase_1<View>::find_equivalent_solutions()
 
       // scale the region
       bounded_region region
-        ( it->get_coefficient(),
-          it->get_right_hand_side()
-          - guaranteed.scalar_product(it->get_coefficient()) );
+        ( h.get_coefficient(),
+          h.get_right_hand_side()
+          - guaranteed.scalar_product(h.get_coefficient()) );
 
       sub_p.decreasing_efficiency( region.get_direction() );
       dynamic_programming_multiple< view_order< subset_view<view_type> > >
@@ -541,9 +676,14 @@ void kp::phase_1<View>::find_equivalent_solutions()
             else
               sol.unset( red_p.get_source_variable( sub_p.get_variable(i) ) );
 
-          result.insert(sol);
+          facet_sols[f].push_back(sol);
         }
     }
 
+  std::set<knapsack_solution> result( m_XSEm.begin(), m_XSEm.end() );
+
+  for (long f=0; f!=n; ++f)
+    result.insert( facet_sols[f].begin(), facet_sols[f].end() );
+
   m_XSEM.insert( m_XSEM.begin(), result.begin(), result.end() );
 } // phase_1::find_equivalent_solutions()
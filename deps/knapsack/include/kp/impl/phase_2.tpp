@@ -11,6 +11,9 @@
 #include <bikp/reduction/simple_variable_fixing.hpp>
 
 #include <cmath>
+#include <vector>
+
+#include <omp.h>
 
 /*----------------------------------------------------------------------------*/
 /**
@@ -19,7 +22,7 @@
 template<typename View>
 kp::phase_2<View>::phase_2
 ( const view_type& inst, const solution_list& XSEM, const constraint_set& hull )
-  : m_kp(inst), m_XSEM(XSEM), m_hull(hull)
+  : m_kp(inst), m_XSEM(XSEM), m_hull(hull), m_epsilon(0)
 {
 
 } // phase_2::phase_2()
@@ -34,6 +37,22 @@ const kp::maximum_set& kp::phase_2<View>::get_XNSEM() const
   return m_XNSEM;
 } // phase_2::get_XNSEM()
 
+/*----------------------------------------------------------------------------*/
+/**
+ * \brief Search a (1 + epsilon)-approximation of the non supported points.
+ * \param epsilon The approximation ratio. All the efficient solutions are
+ *        searched if it is zero.
+ *
+ * For each efficient solution z, the solutions found by run() and the
+ * supported solutions contain a solution s such that z <= (1 + epsilon) * s
+ * on all the objectives.
+ */
+template<typename View>
+void kp::phase_2<View>::set_approximation( double epsilon )
+{
+  m_epsilon = epsilon;
+} // phase_2::set_approximation()
+
 /*----------------------------------------------------------------------------*/
 /**
  * \brief
@@ -50,42 +69,69 @@ void kp::phase_2<View>::run()
   bound_set E(nadir);
   build_bound_set(E);
 
+#if 0
   unsigned int nb_it = m_hull.size();
   unsigned int i=1;
+#endif
   
   typename std::map<moo::real_type, constraint_set>::const_iterator it_v;
   typename constraint_set::const_iterator it_c;
 
   while (!E.empty())
     {
-      constraint_type h;
-      cost_vector_list U;
-      choose_weight_and_points(H, E, h, U);
+      std::vector<constraint_type> h;
+      std::vector<cost_vector_list> U;
 
+      choose_weight_and_points
+        (H, E, omp_in_parallel() ? 1 : omp_get_max_threads(), h, U);
+
+#if 0
       std::cout << "ranking " << i << "/" << nb_it << ", "
                 << m_XNSEM.size() << " solutions" << std::endl;
-      ++i;
+      i += h.size();
+#endif
+
+      const long n = h.size();
+      std::vector<solution_list> sols(n);
+      std::vector<pareto_set> out_profits(n);
 
-      bounded_region region( h.get_coefficient(), nadir );
+      // m_XNSEM is only read during the loop
+#pragma omp parallel for schedule(dynamic, 1) if (n > 1)
+      for (long j=0; j<n; ++j)
+        {
+          bounded_region region( h[j].get_coefficient(), nadir );
 
-      region.insert_nadirs(U.begin(), U.end());
+          region.insert_nadirs(U[j].begin(), U[j].end());
 
-      /*if ( region.bound_set_size() != U.size() )
-        std::cout << "phase_2<View>::run(): "
-                  << region.bound_set_size() << " != " << U.size()
-                  << std::endl;*/
+          /*if ( region.bound_set_size() != U.size() )
+            std::cout << "phase_2<View>::run(): "
+                      << region.bound_set_size() << " != " << U.size()
+                      << std::endl;*/
 
-      pareto_set out_profits;
-      reduce_and_solve( region, out_profits );
+          reduce_and_solve( region, sols[j], out_profits[j] );
+        }
 
-      H.erase( std::find(H.begin(), H.end(), h) );
+      for (long j=0; j!=n; ++j)
+        {
+          m_XNSEM.insert( sols[j].begin(), sols[j].end() );
 
-      for ( ; !U.empty(); U.pop_front() )
-        E.erase( U.front() );
+          H.erase( std::find(H.begin(), H.end(), h[j]) );
 
-      for ( pareto_set::const_iterator it=out_profits.begin();
-            it!=out_profits.end(); ++it )
-        E.reduce(*it);
+          for ( ; !U[j].empty(); U[j].pop_front() )
+            E.erase( U[j].front() );
+        }
+
+      for (long j=0; j!=n; ++j)
+        for ( pareto_set::const_iterator it=out_profits[j].begin();
+              it!=out_profits[j].end(); ++it )
+          E.reduce(*it);
+
+      // the new solutions cover some points of the regions of the other
+      // facets
+      if ( m_epsilon > 0 )
+        for (long j=0; j!=n; ++j)
+          for ( it_s=sols[j].begin(); it_s!=sols[j].end(); ++it_s )
+            E.reduce( cover(it_s->image()) );
     }
 } // phase_2::run()
 
@@ -95,10 +141,9 @@ void kp::phase_2<View>::run()
  */
 template<typename View>
 void kp::phase_2<View>::solve
-( const bounded_region& region, pareto_set& out_profits )
+( const bounded_region& region, solution_list& sols,
+  pareto_set& out_profits ) const
 {
-  solution_list sols;
-
   bounded_region r(region);
   view_order<view_type> mono_p( m_kp );
   mono_p.decreasing_efficiency( region.get_direction() );
@@ -114,8 +159,6 @@ void kp::phase_2<View>::solve
 #endif
 
   ranking< view_order<view_type> > solver( mono_p, r, sols, out_profits );
-
-  m_XNSEM.insert( sols.begin(), sols.end() );
 } // phase_2::solve()
 
 /*----------------------------------------------------------------------------*/
@@ -124,7 +167,8 @@ void kp::phase_2<View>::solve
  */
 template<typename View>
 void kp::phase_2<View>::reduce_and_solve
-( const bounded_region& region, pareto_set& out_profits )
+( const bounded_region& region, solution_list& sols,
+  pareto_set& out_profits ) const
 {
   mono_problem mono_p(m_kp.get_size(), m_kp.get_capacity());
 
@@ -137,15 +181,17 @@ void kp::phase_2<View>::reduce_and_solve
   mono_p.sort_by_decreasing_efficiency();
   simple_variable_fixing red(mono_p, region.get_lower_bound());
 
+#if 0
   std::cout << "Fixing " << red.set_variables().size()
             << " variables to one, " << red.unset_variables().size()
             << " to zero ("
             << ( m_kp.get_size() - red.set_variables().size()
                  - red.unset_variables().size() ) << '/' << m_kp.get_size()
             << " remaining)." << std::endl;
+#endif
 
   if ( red.set_variables().size() + red.unset_variables().size() == 0 )
-    solve(region, out_profits);
+    solve(region, sols, out_profits);
   else
     {
       // get the guaranteed profit and compute the remaining capacity
@@ -172,18 +218,12 @@ void kp::phase_2<View>::reduce_and_solve
 
       // scale the region
       bounded_region sub_region
-        ( region.get_direction(), region.get_nadir() - guaranteed );
+        ( region.get_direction(), shift(region.get_nadir(), guaranteed) );
       std::list<cost_vector> nadir;
 
       for ( bound_set::const_iterator it=region.bound_set_begin();
             it!=region.bound_set_end(); ++it )
-        {
-          assert( (*it)[0] >= guaranteed[0] );
-          assert( (*it)[1] >= guaranteed[1] );
-          assert( (*it)[2] >= guaranteed[2] );
-
-          nadir.push_back(*it - guaranteed);
-        }
+        nadir.push_back( shift(*it, guaranteed) );
 
       sub_region.insert_nadirs(nadir.begin(), nadir.end());
 
@@ -219,7 +259,7 @@ void kp::phase_2<View>::reduce_and_solve
               else
                 sol.unset( red_p.get_source_variable( sub_p.get_variable(i) ) );
 
-            m_XNSEM.insert(sol);
+            sols.push_front(sol);
           }
     }
 } // phase_2::reduce_and_solve()
@@ -230,13 +270,54 @@ void kp::phase_2<View>::reduce_and_solve
  */
 template<typename View>
 void kp::phase_2<View>::choose_weight_and_points
-( const std::list<constraint_type>& H, const bound_set& E,
-  constraint_type& h, cost_vector_list& U) const
+( const std::list<constraint_type>& H, const bound_set& E, std::size_t count,
+  std::vector<constraint_type>& h, std::vector<cost_vector_list>& U ) const
 {
+  h.clear();
   U.clear();
 
-  typename bound_set::const_iterator it_n;
   std::map<constraint_type, cost_vector_list> U_c;
+  assign_points(H, E, U_c);
+
+  // the facets, by increasing distance to their farthest point, then in the
+  // order of U_c
+  std::multimap<moo::real_type, constraint_type> candidates;
+  typename std::map<constraint_type, cost_vector_list>::const_iterator it_h;
+
+  for ( it_h=U_c.begin(); it_h!=U_c.end(); ++it_h )
+    {
+      moo::real_type max_dist = 0;
+      typename cost_vector_list::const_iterator it_s;
+
+      for ( it_s=it_h->second.begin(); it_s!=it_h->second.end(); ++it_s )
+        max_dist = std::max( max_dist, dist(*it_s, it_h->first) );
+
+      candidates.insert( std::make_pair(max_dist, it_h->first) );
+    }
+
+  typename std::multimap<moo::real_type, constraint_type>::const_iterator it;
+
+  for ( it=candidates.begin(); (it!=candidates.end()) && (h.size()!=count);
+        ++it )
+    {
+      h.push_back(it->second);
+      U.push_back(U_c[it->second]);
+    }
+} // phase_2::choose_weight_and_points()
+
+/*----------------------------------------------------------------------------*/
+/**
+ * \brief Group the points of the bound set by their closest facet.
+ * \param H The facets.
+ * \param E The bound set.
+ * \param U_c (out) The points of \a E closest to each facet.
+ */
+template<typename View>
+void kp::phase_2<View>::assign_points
+( const std::list<constraint_type>& H, const bound_set& E,
+  std::map<constraint_type, cost_vector_list>& U_c ) const
+{
+  typename bound_set::const_iterator it_n;
 
   for ( it_n=E.begin(); it_n!=E.end(); ++it_n )
     {
@@ -257,26 +338,7 @@ void kp::phase_2<View>::choose_weight_and_points
 
       U_c[h_prime].push_front(*it_n);
     }
-
-  typename std::map<constraint_type, cost_vector_list>::const_iterator it_h;
-  moo::real_type min_dist = std::numeric_limits<moo::real_type>::infinity();
-
-  for ( it_h=U_c.begin(); it_h!=U_c.end(); ++it_h )
-    {
-      moo::real_type max_dist = 0;
-      typename cost_vector_list::const_iterator it_s;
-
-      for ( it_s=it_h->second.begin(); it_s!=it_h->second.end(); ++it_s )
-        max_dist = std::max( max_dist, dist(*it_s, it_h->first) );
-
-      if (max_dist < min_dist)
-        {
-          min_dist = max_dist;
-          h = it_h->first;
-          U = it_h->second;
-        }
-    }
-} // phase_2::choose_weight_and_points()
+} // phase_2::assign_points()
 
 /*----------------------------------------------------------------------------*/
 /**
@@ -432,12 +494,59 @@ void kp::phase_2<View>::build_bound_set( bound_set& bs ) const
   typename solution_list::const_iterator it;
 
   for ( it=m_XSEM.begin(); it!=m_XSEM.end(); ++it )
-    bs.reduce(it->image());
+    bs.reduce( cover(it->image()) );
 
   for ( it=m_XNSEM.begin(); it!=m_XNSEM.end(); ++it )
-    bs.reduce(it->image());
+    bs.reduce( cover(it->image()) );
 } // phase_2::build_bound_set()
 
+/*----------------------------------------------------------------------------*/
+/**
+ * \brief Get the bound of a region in the sub problem where some variables are
+ *        fixed to one.
+ * \param u The bound in the initial problem.
+ * \param guaranteed The profit of the variables fixed to one.
+ *
+ * The profits of the sub problem are not negative, so the coordinates of
+ * \a u lower than the guaranteed profit do not bound anything. They are
+ * replaced by -1, which does not bound anything either.
+ */
+template<typename View>
+kp::cost_vector kp::phase_2<View>::shift
+( const cost_vector& u, const cost_vector& guaranteed ) const
+{
+  cost_vector result( u - guaranteed );
+
+  for ( std::size_t i=0; i!=result.size(); ++i )
+    if ( result[i] < 0 )
+      result[i] = -1;
+
+  return result;
+} // phase_2::shift()
+
+/*----------------------------------------------------------------------------*/
+/**
+ * \brief Get the greatest point covered by a given point with the
+ *        approximation ratio.
+ * \param y The covering point.
+ *
+ * The profits are integers, so the coordinates are rounded down: a point is
+ * covered by \a y if and only if it is dominated by or equal to the result.
+ */
+template<typename View>
+kp::cost_vector kp::phase_2<View>::cover( const cost_vector& y ) const
+{
+  if ( m_epsilon == 0 )
+    return y;
+
+  cost_vector result(y);
+
+  for ( std::size_t i=0; i!=result.size(); ++i )
+    result[i] = std::floor( (double)y[i] * (1 + m_epsilon) );
+
+  return result;
+} // phase_2::cover()
+
 /*----------------------------------------------------------------------------*/
 /**
  * \brief
@@ -460,7 +569,9 @@ kp::cost_vector kp::phase_2<View>::compute_nadir()
       if ( it->image()[i] < result[i] )
         result[i] = it->image()[i];
 
+#if 0
   std::cout << "nadir: " << result << std::endl;
+#endif
   return result;
 } // phase_2::compute_nadir()
 
@@ -20,33 +20,18 @@
 
 /*----------------------------------------------------------------------------*/
 /**
- * \brief Copy Constructor.
+ * \brief Constructor.
  * \param that the set to copy from.
  * \param v The vertex to be added to \a that.
- * \remark \a that must be dynamically allocated.
  */
 template<typename View>
-kp::ranking<View>::vertex_set::vertex_set
-( const vertex_set* that, const vertex& v )
+kp::ranking<View>::vertex_set::vertex_set( vertex_set* that, const vertex& v )
   : m_links(1), m_parent(that), m_turning(v)
 {
   if (m_parent)
-    const_cast<vertex_set*>(m_parent)->add_link();
+    m_parent->add_link();
 } // kp::ranking<View>::vertex_set::vertex_set()
 
-/*----------------------------------------------------------------------------*/
-/**
- * \brief Desctructor.
- */
-template<typename View>
-kp::ranking<View>::vertex_set::~vertex_set()
-{
-  assert( m_links == 0 );
-
-  if (m_parent)
-    const_cast<vertex_set*>(m_parent)->remove_link();
-} // kp::ranking<View>::vertex_set::~vertex_set()
-
 /*----------------------------------------------------------------------------*/
 /**
  * \brief Get the vertices in the set.
@@ -57,13 +42,13 @@ template<typename View>
 void
 kp::ranking<View>::vertex_set::get_vertices( set_type& vertices ) const
 {
-  assert( vertices.empty() ? true
-          : m_turning.index() > vertices.front()->index() );
-
-  vertices.push_front( &m_turning );
+  for ( const vertex_set* s = this; s != NULL; s = s->m_parent )
+    {
+      assert( vertices.empty() ? true
+              : s->m_turning.index() > vertices.front()->index() );
 
-  if ( m_parent )
-    m_parent->get_vertices( vertices );
+      vertices.push_front( &s->m_turning );
+    }
 } // kp::ranking<View>::vertex_set::get_vertices()
 
 /*----------------------------------------------------------------------------*/
@@ -78,49 +63,42 @@ const kp::vertex& kp::ranking<View>::vertex_set::last_vertex() const
 
 /*----------------------------------------------------------------------------*/
 /**
- * \brief Release this instance.
- */
-template<typename View>
-void kp::ranking<View>::vertex_set::release()
-{
-  remove_link();
-} // kp::ranking<View>::vertex_set::release()
-
-/*----------------------------------------------------------------------------*/
-/**
- * \brief Add a link to this set.
+ * \brief Get the set of which this one is an extension.
  */
 template<typename View>
-void kp::ranking<View>::vertex_set::add_link()
+typename kp::ranking<View>::vertex_set*
+kp::ranking<View>::vertex_set::parent() const
 {
-  ++m_links;
-} // kp::ranking<View>::vertex_set::add_link()
+  return m_parent;
+} // kp::ranking<View>::vertex_set::parent()
 
 /*----------------------------------------------------------------------------*/
 /**
  * \brief Remove a link to this set.
+ * \return true if there is no more link to this set.
  */
 template<typename View>
-void kp::ranking<View>::vertex_set::remove_link()
+bool kp::ranking<View>::vertex_set::remove_link()
 {
   assert( m_links > 0 );
 
   --m_links;
 
-  if (m_links == 0)
-    delete this;
+  return m_links == 0;
 } // kp::ranking<View>::vertex_set::remove_link()
 
+/*----------------------------------------------------------------------------*/
+/**
+ * \brief Add a link to this set.
+ */
+template<typename View>
+void kp::ranking<View>::vertex_set::add_link()
+{
+  ++m_links;
+} // kp::ranking<View>::vertex_set::add_link()
 
 
 
-// counters of instances of the path class.
-template<typename View>
-unsigned int kp::ranking<View>::path::inst_count;
-template<typename View>
-unsigned int kp::ranking<View>::path::inst_count_max;
-template<typename View>
-unsigned int kp::ranking<View>::path::current;
 
 /*----------------------------------------------------------------------------*/
 /**
@@ -141,41 +119,20 @@ kp::ranking<View>::path::path( const vertex& r )
 /**
  * \brief Constructor.
  * \param that The parent path.
- * \param t The out-vertex to take to quit the path.
+ * \param s The out-vertices of \a that plus the one to take to quit the path.
  * \param p The profit of this path.
  *
  * Paths made with this constructor have one more out-vertex compared to their
  * parent path. They represent non-optimal paths starting from the vertex \a r.
- *
- * \pre that.make() has been called.
  */
 template<typename View>
 kp::ranking<View>::path::path
-( const path& that, const vertex& t, const cost_vector& p )
-  : m_vertices(new vertex_set(that.m_vertices, t)), m_root(that.m_root),
-    m_profit(p)
+( const path& that, vertex_set* s, const cost_vector& p )
+  : m_vertices(s), m_root(that.m_root), m_profit(p)
 {
-  /*if ( ++inst_count > inst_count_max )
-    inst_count_max = inst_count;
-
-    if ( inst_count % 100 == 0 )
-    std::cout << inst_count << " (max " << inst_count_max << ") "
-    << current << std::endl;*/
+  assert( s->parent() == that.m_vertices );
 } // kp::ranking<View>::path::path()
 
-/*----------------------------------------------------------------------------*/
-/**
- * \brief Destructor.
- */
-template<typename View>
-kp::ranking<View>::path::~path()
-{
-  //--inst_count;
-
-  if (m_vertices)
-    m_vertices->release();
-} // kp::ranking<View>::path::~path()
-
 /*----------------------------------------------------------------------------*/
 /**
  * \brief Get the vertices in the path.
@@ -224,6 +181,17 @@ const kp::vertex& kp::ranking<View>::path::last_vertex() const
     return m_vertices->last_vertex();
 } // kp::ranking<View>::path::last_vertex()
 
+/*----------------------------------------------------------------------------*/
+/**
+ * \brief Get the out-vertices of the path.
+ */
+template<typename View>
+typename kp::ranking<View>::vertex_set*
+kp::ranking<View>::path::vertices() const
+{
+  return m_vertices;
+} // kp::ranking<View>::path::vertices()
+
 
 
 
@@ -262,7 +230,7 @@ kp::ranking<View>::~ranking()
       typename quality_table_value_type::iterator it;
       
       for ( it=it_1->second.begin(); it!=it_1->second.end(); ++it )
-        delete *it;
+        delete_path(*it);
     }
 
   if (m_graph)
@@ -285,12 +253,15 @@ void kp::ranking<View>::build_graph()
   const moo::real_type min_profit( m_paths_region.get_lower_bound() );
   const kp::cost_vector& dir = m_paths_region.get_direction();
 
-  for ( unsigned int i=0; i!=layer.size(); ++i )
+  // the paths are stacked, so the layer is read backward to explore the
+  // vertices in increasing order of their weight
+  for ( unsigned int i=layer.size(); i!=0; --i )
     {
-      const moo::real_type mono_profit = layer[i]->profit().scalar_product(dir);
+      const moo::real_type mono_profit =
+        layer[i-1]->profit().scalar_product(dir);
 
       if ( mono_profit >= min_profit )
-        m_quality_table[mono_profit].push_back( new path(*layer[i]) );
+        m_quality_table[mono_profit].push_back( new_path(*layer[i-1]) );
     }
 } // kp::ranking<View>::build_graph()
 
@@ -342,8 +313,8 @@ void kp::ranking<View>::build_solutions()
                   ref_date = now;
                 }
 #endif
-              path* p = it->second.front();
-              it->second.pop_front();
+              path* p = it->second.back();
+              it->second.pop_back();
 
               if ( !m_paths_region.contains( p->profit() ) )
                 build_next_path(*p);
@@ -355,7 +326,7 @@ void kp::ranking<View>::build_solutions()
                   add_solution( sol );
                 }
 	    
-              delete p;
+              delete_path(p);
             }
 	  
           m_quality_table.erase(it);
@@ -563,9 +534,8 @@ void kp::ranking<View>::add_path
     {
       if ( m_paths_region.contains(profit) )
         {
-          path* new_path = new path(p, *s, profit);
           m_paths_region.reduce(profit);
-          m_quality_table[mono_profit].push_front( new_path );
+          m_quality_table[mono_profit].push_back( new_path(p, *s, profit) );
 
           if ( (real_type)m_paths_region.get_lower_bound()
                > region_min_profit )
@@ -577,9 +547,9 @@ void kp::ranking<View>::add_path
 
           if ( m_paths_region.contains(max_profit) )
             {
-              path* new_path = new path(p, *s, profit);
-              build_next_path(*new_path);
-              delete new_path;
+              path* next = new_path(p, *s, profit);
+              build_next_path(*next);
+              delete_path(next);
             }
         }
     }
@@ -601,10 +571,61 @@ void kp::ranking<View>::clear_table()
     if ( it->first >= lower_bound )
       stop = true;
     else
-      for ( ; !it->second.empty(); it->second.pop_front() )
-        delete it->second.front();
+      for ( ; !it->second.empty(); it->second.pop_back() )
+        delete_path( it->second.back() );
 } // ranking::clear_table()
 
+/*----------------------------------------------------------------------------*/
+/**
+ * \brief Create an optimal path starting from a given vertex.
+ * \param r The root of the path.
+ */
+template<typename View>
+typename kp::ranking<View>::path*
+kp::ranking<View>::new_path( const vertex& r )
+{
+  return new (m_path_pool.allocate()) path(r);
+} // kp::ranking<View>::new_path()
+
+/*----------------------------------------------------------------------------*/
+/**
+ * \brief Create a path with one more out-vertex than an other path.
+ * \param that The parent path.
+ * \param t The out-vertex to take to quit the path.
+ * \param p The profit of the new path.
+ */
+template<typename View>
+typename kp::ranking<View>::path*
+kp::ranking<View>::new_path
+( const path& that, const vertex& t, const cost_vector& p )
+{
+  vertex_set* s =
+    new (m_vertex_set_pool.allocate()) vertex_set(that.vertices(), t);
+
+  return new (m_path_pool.allocate()) path(that, s, p);
+} // kp::ranking<View>::new_path()
+
+/*----------------------------------------------------------------------------*/
+/**
+ * \brief Delete a path and the sets of out-vertices that are not used
+ *        anymore.
+ * \param p The path to delete.
+ */
+template<typename View>
+void kp::ranking<View>::delete_path( path* p )
+{
+  vertex_set* s = p->vertices();
+
+  while ( (s != NULL) && s->remove_link() )
+    {
+      vertex_set* parent = s->parent();
+      m_vertex_set_pool.destroy(s);
+      s = parent;
+    }
+
+  m_path_pool.destroy(p);
+} // kp::ranking<View>::delete_path()
+
 /*----------------------------------------------------------------------------*/
 /**
  * \brief Set the value of a variable in the solution.
@@ -177,7 +177,8 @@ void kp::view_order<View>::topological_efficiency()
 
   typedef boost::adjacency_list<> graph_type;
   
-  graph_type g;
+  // declare all the vertices, the ones without edge must be sorted too
+  graph_type g(s);
   float_compare compare;
 
   for (unsigned int i=0; i!=s; ++i)
@@ -8,6 +8,7 @@
 
 #include "kp/variable.hpp"
 #include <iostream>
+#include <vector>
 
 namespace kp
 {
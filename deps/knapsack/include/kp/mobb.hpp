@@ -7,15 +7,19 @@
 #define __KP_MOBB_HPP__
 
 #include <kp/order_on_items.hpp>
-#include <kp/view_order.hpp>
-#include <kp/types.hpp>
-#include <moo/bound_set.hpp>
+#include <kp/solution_data.hpp>
 
 
 namespace kp
 {
   /**
    * \brief A multi-objective branch and bound for the knapsack problem.
+   *
+   * When OpenMP gives more than one thread, the subtrees near the root are
+   * explored by OpenMP tasks, each with its own copy of the solution under
+   * construction. The efficient solutions and the bound set are shared, thus
+   * a subtree is fathomed with the solutions found by all the tasks.
+   *
    * \author Julien Jorge
    */
   class mobb
@@ -32,19 +36,19 @@ namespace kp
       void run();
 
     private:
-      bool dominates( unsigned int i, unsigned int j ) const;
-
-      void bb( moo::real_type w, knapsack_solution& sol, unsigned int n );
+      void bb
+      ( moo::real_type w, knapsack_solution& sol, unsigned int n,
+        unsigned int depth );
 
       unsigned int next_index( const knapsack_solution& sol ) const;
 
       void branch_one
       ( moo::real_type w, knapsack_solution& sol, unsigned int i,
-        unsigned int n );
+        unsigned int n, unsigned int depth );
 
       void branch_zero
       ( moo::real_type w, knapsack_solution& sol, unsigned int i,
-        unsigned int n );
+        unsigned int n, unsigned int depth );
 
       unsigned int unset_big_items
       ( moo::real_type w, knapsack_solution& sol,
@@ -90,21 +94,13 @@ namespace kp
       /** \brief The knapsack to solve. */
       const knapsack_instance& m_instance;
 
-      /** \brief The knapsack to explore. */
-      view_order<> m_kp;
-
-      /** \brief A lower bound on the cardinality of the efficient solutions. */
-      unsigned int m_kp_card_lb;
-
-      /** \brief An lower bound set for the value of the efficient solutions. */
-      bound_set_type m_bound_set;
-
-      /** \brief The efficient solutions found. */
-      maximum_set& m_solutions;
+      /** \brief The ordered knapsack, the efficient solutions found and the
+          bound set, shared by the tasks. */
+      solution_data m_data;
 
-      /** \brief m_dominates[i][j] tells if a variable i dominates an other
-          variable j. */
-      std::vector< std::vector<bool> > m_dominates;
+      /** \brief The subtrees whose root is less deep than this are explored
+          by new tasks. */
+      unsigned int m_task_depth;
 
     }; // class bb_procedure
 
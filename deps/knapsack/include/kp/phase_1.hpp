@@ -18,6 +18,20 @@ namespace kp
 {
   /**
    * \brief An algorithm to compute the coordinates of all supported solutions.
+   *
+   * The polytopes of the weight set are refined one point at a time, since
+   * each refinement updates the adjacency of the points. When several threads
+   * are available, the bi-objective problems of the next facets of the
+   * current polytope are solved in parallel ahead of time; a result is used
+   * only if its facet is still the one to explore, so the output is the same
+   * as with a single thread. The equivalent solutions on the facets of the
+   * hull are computed in parallel too.
+   *
+   * The cache of the bi-objective problems only receives the problems solved
+   * ahead of time by solve_next_facets(), for the next candidates of the
+   * current point; all the cache hits come from this prefetching. An entry is
+   * removed from the cache once it has been used.
+   *
    * \author Julien Jorge
    */
   template<typename View = knapsack_instance>
@@ -33,6 +47,14 @@ namespace kp
     typedef weight_set_type::neighbor_type neighbor_type;
     typedef std::map<cost_vector, std::list<cost_vector> > adjacency_type;
 
+    /** \brief A couple of weights defining a bi-objective problem. */
+    typedef std::pair<cost_vector, cost_vector> bicriteria_key;
+
+    /** \brief The solutions of the bi-objective problems, for a given couple
+        of weights. */
+    typedef std::map< bicriteria_key, std::list<knapsack_solution> >
+    bicriteria_cache_type;
+
   public:
     phase_1( const view_type& inst );
 
@@ -40,6 +62,9 @@ namespace kp
     const std::list<knapsack_solution>& get_XSEM() const;
     const std::set<constraint_type>& get_hull() const;
 
+    std::size_t get_bicriteria_cache_hits() const;
+    std::size_t get_bicriteria_cache_misses() const;
+
     void run();
 
   private:
@@ -51,6 +76,15 @@ namespace kp
     ( const std::list<knapsack_solution>& X, weight_set_type& w_p );
 
     void rebuild_potentially_adjacents( weight_set_type& w_p );
+
+    void facet_weights
+    ( const neighbor_type& f, cost_vector& lambda_1,
+      cost_vector& lambda_2 ) const;
+    void solve_next_facets( const weight_set_type& w_p );
+    bool take_cached_solutions
+    ( const cost_vector& lambda_1, const cost_vector& lambda_2,
+      std::list<knapsack_solution>& X );
+
     void lexicographic_optimal();
     void bicriteria_solver
     ( const cost_vector& lambda_1, const cost_vector& lambda_2,
@@ -90,6 +124,18 @@ namespace kp
     /** \brief The constraints defining the hull of the supported solutions. */
     std::set<constraint_type> m_hull;
 
+    /** \brief The solutions of the bi-objective problems solved ahead of
+        time, whose facet has not been explored yet. */
+    bicriteria_cache_type m_bicriteria_cache;
+
+    /** \brief How many bi-objective problems have been found in the cache
+        when their facet was explored. */
+    std::size_t m_bicriteria_cache_hits;
+
+    /** \brief How many bi-objective problems had to be solved when their
+        facet was explored. */
+    std::size_t m_bicriteria_cache_misses;
+
   }; // class phase_1
 } // namespace kp
 
@@ -13,11 +13,24 @@
 #include <list>
 #include <map>
 #include <set>
+#include <vector>
 
 namespace kp
 {
   /**
    * \brief An algorithm to compute all supported solutions.
+   *
+   * When several threads are available, each iteration of run() solves the
+   * regions of as many facets of the hull as there are threads, in parallel.
+   * The solutions and the profits found out of the regions are merged in the
+   * order in which the facets were chosen, so the result does not depend on
+   * the scheduling. Inside a parallel region, one facet is solved per
+   * iteration, as with a single thread.
+   *
+   * With an approximation ratio \f$\epsilon > 0\f$, the bound set is reduced
+   * with the known points multiplied by \f$1 + \epsilon\f$, so the regions
+   * of the facets do not contain the points covered by these ones.
+   *
    * \author Julien Jorge
    */
   template<typename View = knapsack_instance>
@@ -38,16 +51,24 @@ namespace kp
 
     const maximum_set& get_XNSEM() const;
 
+    void set_approximation( double epsilon );
     void run();
 
   private:
-    void solve( const bounded_region& region, pareto_set& out_profits );
+    void solve
+    ( const bounded_region& region, solution_list& sols,
+      pareto_set& out_profits ) const;
     void reduce_and_solve
-    ( const bounded_region& region, pareto_set& out_profits );
+    ( const bounded_region& region, solution_list& sols,
+      pareto_set& out_profits ) const;
 
     void choose_weight_and_points
     ( const std::list<constraint_type>& H, const bound_set& E,
-      constraint_type& h, cost_vector_list& U) const;
+      std::size_t count, std::vector<constraint_type>& h,
+      std::vector<cost_vector_list>& U ) const;
+    void assign_points
+    ( const std::list<constraint_type>& H, const bound_set& E,
+      std::map<constraint_type, cost_vector_list>& U_c ) const;
 
     void compute_distances
     ( std::map<moo::real_type, constraint_set>& val,
@@ -60,6 +81,9 @@ namespace kp
 
     moo::real_type dist( const cost_vector& u, const constraint_type& h ) const;
     void build_bound_set( bound_set& bs ) const;
+    cost_vector shift
+    ( const cost_vector& u, const cost_vector& guaranteed ) const;
+    cost_vector cover( const cost_vector& y ) const;
 
     cost_vector compute_nadir();
     void solve_bi( unsigned int a, unsigned int b );
@@ -77,6 +101,10 @@ namespace kp
     /** \brief The not supported solutions, including al equivalent ones. */
     maximum_set m_XNSEM;
 
+    /** \brief The approximation ratio of the computed points. Zero for an
+        exact computation. */
+    double m_epsilon;
+
   }; // class phase_2
 } // namespace kp
 
@@ -20,13 +20,20 @@
 #ifndef __KP_RANKING_HPP__
 #define __KP_RANKING_HPP__
 
+#include <moo/object_pool.hpp>
+
 #include <list>
 #include <map>
+#include <vector>
 
 namespace kp
 {
   /**
    * \brief An algorithm that builds the k best-solutions of a knapsack problem.
+   *
+   * The paths and their sets of turning vertices are numerous and short-lived;
+   * they are allocated in pools owned by the instance.
+   *
    * \author Julien Jorge.
    */
   template<typename View>
@@ -51,18 +58,16 @@ namespace kp
       typedef std::list<const_vertex_ptr> set_type;
 
     public:
-      vertex_set( const vertex_set* that, const vertex& v );
+      vertex_set( vertex_set* that, const vertex& v );
 
       void get_vertices( set_type& vertices ) const;
       const vertex& last_vertex() const;
+      vertex_set* parent() const;
 
-      void release();
+      bool remove_link();
 
     private:
       void add_link();
-      void remove_link();
-
-      ~vertex_set();
 
     private:
       /** \brief The number of link to this set (ie. the number of sets
@@ -71,7 +76,7 @@ namespace kp
 
       /** \brief The edges in this set. This value is shared between the
           instances. */
-      const vertex_set* m_parent;
+      vertex_set* m_parent;
 
       /** \brief The edge that make this set different of its parent. */
       const vertex& m_turning;
@@ -88,18 +93,14 @@ namespace kp
     {
     public:
       path( const vertex& r );
-      path( const path& that, const vertex& t, const cost_vector& p );
-      ~path();
+      path( const path& that, vertex_set* s, const cost_vector& p );
 
       void get_vertices( std::list<const_vertex_ptr>& vertices ) const;
 
       const cost_vector& profit() const;
       const vertex& root() const;
       const vertex& last_vertex() const;
-
-      static unsigned int inst_count;
-      static unsigned int inst_count_max;
-      static unsigned int current;
+      vertex_set* vertices() const;
 
     private:
       /** \brief The out-vertices in the path (vertices that are not on the
@@ -114,8 +115,9 @@ namespace kp
 
     }; // class path
 
-    /** \brief The container use for storing paths. */
-    typedef std::list<path*> quality_table_value_type;
+    /** \brief The container use for storing paths. It is used as a stack:
+        the next path to explore is at the back. */
+    typedef std::vector<path*> quality_table_value_type;
 
     /** \brief The type of the table containing paths for each solution
         quality. */
@@ -152,6 +154,10 @@ namespace kp
 
     void clear_table();
 
+    path* new_path( const vertex& r );
+    path* new_path( const path& that, const vertex& t, const cost_vector& p );
+    void delete_path( path* p );
+
     void set_solution_variable
     ( unsigned int i, knapsack_solution& sol, bool in ) const;
 
@@ -183,6 +189,12 @@ namespace kp
     /** \brief The profits found out of the search area. */
     pareto_set& m_out_profits;
 
+    /** \brief The memory of the sets of turning vertices. */
+    moo::object_pool<vertex_set> m_vertex_set_pool;
+
+    /** \brief The memory of the paths. */
+    moo::object_pool<path> m_path_pool;
+
   }; // class ranking
 } // namespace kp
 
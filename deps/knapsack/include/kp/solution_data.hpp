@@ -10,10 +10,25 @@
 #include <kp/types.hpp>
 #include <moo/bound_set.hpp>
 
+#include <omp.h>
+#include <vector>
+
 namespace kp
 {
   /**
    * \brief Solution data for solvers.
+   *
+   * The solutions and the bound set can be shared by several threads: insert()
+   * and is_dominated() are protected by a lock, and the threads iterating on
+   * the bound set must hold it with lock() and unlock(). The lock is
+   * reentrant.
+   *
+   * The dominance relation between the items is stored as two bit matrices,
+   * one row of words per item, indexed as the view: the row of an item in
+   * get_dominated_row() tells the items it dominates and its row in
+   * get_dominating_row() tells the items dominating it. The solvers combine
+   * these rows with the mask of the free variables, a word at a time.
+   *
    * \author Julien Jorge
    */
   class solution_data
@@ -21,12 +36,19 @@ namespace kp
   public:
     typedef moo::bound_set<cost_compare> bound_set_type;
 
+    /** \brief The type of the words of the bit matrices. */
+    typedef unsigned long word_type;
+
+    /** \brief The number of bits in a word_type. */
+    static const std::size_t word_bits = sizeof(word_type) * 8;
+
   public:
     solution_data
     ( const knapsack_instance& inst, maximum_set& solutions, int o );
+    ~solution_data();
 
     const knapsack_instance& get_instance() const;
-    const view_order<> get_view() const;
+    const view_order<>& get_view() const;
     std::size_t get_cardinality_lower_bound() const;
       
     void insert( const knapsack_solution& sol );
@@ -35,14 +57,29 @@ namespace kp
     bool is_dominated( const cost_vector& y ) const;
     bool first_dominates_second( std::size_t i, std::size_t j ) const;
 
+    std::size_t get_row_size() const;
+    const word_type* get_dominated_row( std::size_t i ) const;
+    const word_type* get_dominating_row( std::size_t j ) const;
+    void get_free_variables
+    ( const knapsack_solution& sol, std::vector<word_type>& free_vars ) const;
+
+    static std::size_t lowest_bit( word_type w );
+
     bound_set_type::const_iterator bound_set_begin() const;
     bound_set_type::const_iterator bound_set_end() const;
 
     bool is_modified() const;
     void unset_modified();
 
+    void lock() const;
+    void unlock() const;
+
   private:
+    solution_data( const solution_data& that );
+    solution_data& operator=( const solution_data& that );
+
     bool dominates( std::size_t i, std::size_t j ) const;
+    void build_dominance_matrices();
 
   private:
     /** \brief The initial knapsack instance. */
@@ -60,14 +97,24 @@ namespace kp
     /** \brief The efficient solutions found. */
     maximum_set& m_solutions;
 
-    /** \brief m_dominates[i][j] tells if a variable i dominates an other
-        variable j. */
-    std::vector< std::vector<bool> > m_dominates;
+    /** \brief The number of words in a row of the bit matrices. */
+    std::size_t m_row_size;
+
+    /** \brief Bit j of row i tells if the variable i dominates the variable
+        j. */
+    std::vector<word_type> m_dominated;
+
+    /** \brief Bit i of row j tells if the variable i dominates the variable
+        j. */
+    std::vector<word_type> m_dominating;
 
     /** \brief Tell if m_solutions has received a solution corresponding to a
         new non dominated point. */
     bool m_modified;
 
+    /** \brief The lock protecting m_solutions, m_bound_set and m_modified. */
+    mutable omp_nest_lock_t m_lock;
+
   }; // class solution_data
 } // namespace kp
 
@@ -3,6 +3,11 @@
 
 extern "C"
 void twophases(int nb_obj, int sz, float *obj, float *weigths ,float capacity);
+
+extern "C"
+void twophases_front(int nb_obj, int sz, float *obj, float *weigths ,float capacity ,int * &z, int * &solW, bool * &res, int &nbSupported, int &nbSol);
+
+extern "C"
+void twophases_front_approx(int nb_obj, int sz, float *obj, float *weigths ,float capacity, double epsilon, int * &z, int * &solW, bool * &res, int &nbSupported, int &nbSol);
  
 #endif
-
@@ -59,8 +59,15 @@ void moo::bound_set<Compare>::insert( const value_type& v )
 template<typename Compare>
 bool moo::bound_set<Compare>::reduce( const value_type& v )
 {
+  if ( empty() )
+    return false;
+
+  // the first point may be removed, the reference must not be a reference on
+  // it
+  const value_type ref( *begin() );
   bool dummy(false);
-  return reduce(v, *begin(), dummy);
+
+  return reduce(v, ref, dummy);
 } // bound_set::reduce()
 
 /*----------------------------------------------------------------------------*/
@@ -0,0 +1,80 @@
+/**
+ * \file moo/impl/object_pool.tpp
+ * \brief Implementation of the moo::object_pool class.
+ * \author Julien Jorge
+ */
+#include <cassert>
+#include <new>
+
+/*----------------------------------------------------------------------------*/
+/**
+ * \brief Constructor.
+ * \param block_size The number of objects reserved at once.
+ */
+template<typename T>
+moo::object_pool<T>::object_pool( std::size_t block_size )
+  : m_block_size(block_size), m_free(NULL)
+{
+  assert( block_size != 0 );
+} // object_pool::object_pool()
+
+/*----------------------------------------------------------------------------*/
+/**
+ * \brief Destructor. Release the memory of all the objects.
+ */
+template<typename T>
+moo::object_pool<T>::~object_pool()
+{
+  for (std::size_t i=0; i!=m_blocks.size(); ++i)
+    ::operator delete( m_blocks[i] );
+} // object_pool::~object_pool()
+
+/*----------------------------------------------------------------------------*/
+/**
+ * \brief Get the memory for a new object.
+ */
+template<typename T>
+void* moo::object_pool<T>::allocate()
+{
+  if ( m_free == NULL )
+    add_block();
+
+  void* result = m_free;
+  m_free = *static_cast<void**>(m_free);
+
+  return result;
+} // object_pool::allocate()
+
+/*----------------------------------------------------------------------------*/
+/**
+ * \brief Destroy an object and give its memory back to the pool.
+ * \param p The object, built in the memory returned by allocate().
+ */
+template<typename T>
+void moo::object_pool<T>::destroy( T* p )
+{
+  assert( p != NULL );
+
+  p->~T();
+
+  *reinterpret_cast<void**>(p) = m_free;
+  m_free = p;
+} // object_pool::destroy()
+
+/*----------------------------------------------------------------------------*/
+/**
+ * \brief Reserve a new block and put its slots in the free list.
+ */
+template<typename T>
+void moo::object_pool<T>::add_block()
+{
+  char* block = static_cast<char*>( ::operator new(m_block_size * s_slot_size) );
+  m_blocks.push_back(block);
+
+  for (std::size_t i=m_block_size; i!=0; --i)
+    {
+      void* slot = block + (i - 1) * s_slot_size;
+      *static_cast<void**>(slot) = m_free;
+      m_free = slot;
+    }
+} // object_pool::add_block()
@@ -3,6 +3,7 @@
  * \brief Implementation of the moo::vector class.
  * \author Julien Jorge
  */
+#include <algorithm>
 #include <cassert>
 
 /*----------------------------------------------------------------------------*/
@@ -11,6 +12,7 @@
  */
 template<typename T>
 moo::vector<T>::vector()
+  : m_size(0)
 {
 
 } // vector::vector()
@@ -22,8 +24,9 @@ moo::vector<T>::vector()
  */
 template<typename T>
 moo::vector<T>::vector( unsigned int s )
-  : m_data(s)
+  : m_size(s)
 {
+  assert( s <= MOO_VECTOR_MAX_SIZE );
 
 } // vector::vector()
 
@@ -35,8 +38,10 @@ moo::vector<T>::vector( unsigned int s )
 template<typename T>
 template<typename U>
 moo::vector<T>::vector( const vector<U>& that )
-  : m_data(that.m_data)
+  : m_size(that.size())
 {
+  for (unsigned int i=0; i!=m_size; ++i)
+    m_data[i] = that[i];
 
 } // vector::vector()
 
@@ -48,8 +53,11 @@ moo::vector<T>::vector( const vector<U>& that )
  */
 template<typename T>
 moo::vector<T>::vector( unsigned int s, value_type v )
-  : m_data(s, v)
+  : m_size(s)
 {
+  assert( s <= MOO_VECTOR_MAX_SIZE );
+
+  std::fill( m_data, m_data + m_size, v );
 
 } // vector::vector()
 
@@ -62,6 +70,7 @@ template<typename T>
 typename moo::vector<T>::value_type&
 moo::vector<T>::operator[]( unsigned int i )
 {
+  assert( i < m_size );
   return m_data[i];
 } // vector::operator[]()
 
@@ -74,6 +83,7 @@ template<typename T>
 typename moo::vector<T>::value_type
 moo::vector<T>::operator[]( unsigned int i ) const
 {
+  assert( i < m_size );
   return m_data[i];
 } // vector::operator[]()
 
@@ -84,7 +94,7 @@ moo::vector<T>::operator[]( unsigned int i ) const
 template<typename T>
 unsigned int moo::vector<T>::size() const
 {
-  return m_data.size();
+  return m_size;
 } // vector::size()
 
 /*----------------------------------------------------------------------------*/
@@ -94,7 +104,7 @@ unsigned int moo::vector<T>::size() const
 template<typename T>
 bool moo::vector<T>::empty() const
 {
-  return m_data.empty();
+  return m_size == 0;
 } // vector::empty()
 
 /*----------------------------------------------------------------------------*/
@@ -107,10 +117,10 @@ typename moo::vector<T>::value_type
 moo::vector<T>::scalar_product( const self_type& that ) const
 {
   unsigned int i=0;
-  value_type result = (*this)[i] * that[i];
+  value_type result = m_data[i] * that.m_data[i];
 
-  for ( ++i; i!=size(); ++i )
-    result += (*this)[i] * that[i];
+  for ( ++i; i!=m_size; ++i )
+    result += m_data[i] * that.m_data[i];
 
   return result;
 } // vector::scalar_product()
@@ -123,7 +133,8 @@ moo::vector<T>::scalar_product( const self_type& that ) const
 template<typename T>
 bool moo::vector<T>::operator==( const self_type& that ) const
 {
-  return m_data == that.m_data;
+  return (m_size == that.m_size)
+    && std::equal( m_data, m_data + m_size, that.m_data );
 } // vector::operator==()
 
 /*----------------------------------------------------------------------------*/
@@ -134,7 +145,7 @@ bool moo::vector<T>::operator==( const self_type& that ) const
 template<typename T>
 bool moo::vector<T>::operator!=( const self_type& that ) const
 {
-  return m_data != that.m_data;
+  return !(*this == that);
 } // vector::operator!=()
 
 /*----------------------------------------------------------------------------*/
@@ -145,7 +156,8 @@ bool moo::vector<T>::operator!=( const self_type& that ) const
 template<typename T>
 bool moo::vector<T>::operator<( const self_type& that ) const
 {
-  return m_data < that.m_data;
+  return std::lexicographical_compare
+    ( m_data, m_data + m_size, that.m_data, that.m_data + that.m_size );
 } // vector::operator<()
 
 /*----------------------------------------------------------------------------*/
@@ -156,7 +168,7 @@ bool moo::vector<T>::operator<( const self_type& that ) const
 template<typename T>
 bool moo::vector<T>::operator<=( const self_type& that ) const
 {
-  return m_data <= that.m_data;
+  return !(that < *this);
 } // vector::operator<=()
 
 /*----------------------------------------------------------------------------*/
@@ -167,7 +179,7 @@ bool moo::vector<T>::operator<=( const self_type& that ) const
 template<typename T>
 bool moo::vector<T>::operator>( const self_type& that ) const
 {
-  return m_data > that.m_data;
+  return that < *this;
 } // vector::operator>()
 
 /*----------------------------------------------------------------------------*/
@@ -178,7 +190,7 @@ bool moo::vector<T>::operator>( const self_type& that ) const
 template<typename T>
 bool moo::vector<T>::operator>=( const self_type& that ) const
 {
-  return m_data >= that.m_data;
+  return !(*this < that);
 } // vector::operator>=()
 
 /*----------------------------------------------------------------------------*/
@@ -190,7 +202,7 @@ template<typename T>
 typename moo::vector<T>::self_type&
 moo::vector<T>::operator+=( const self_type& that )
 {
-  for (unsigned int i=0; i!=size(); ++i)
+  for (unsigned int i=0; i!=m_size; ++i)
     m_data[i] += that.m_data[i];
 
   return *this;
@@ -205,7 +217,7 @@ template<typename T>
 typename moo::vector<T>::self_type&
 moo::vector<T>::operator-=( const self_type& that )
 {
-  for (unsigned int i=0; i!=size(); ++i)
+  for (unsigned int i=0; i!=m_size; ++i)
     m_data[i] -= that.m_data[i];
 
   return *this;
@@ -220,7 +232,7 @@ template<typename T>
 typename moo::vector<T>::self_type&
 moo::vector<T>::operator*=( const value_type& v )
 {
-  for (unsigned int i=0; i!=size(); ++i)
+  for (unsigned int i=0; i!=m_size; ++i)
     m_data[i] *= v;
 
   return *this;
@@ -235,7 +247,7 @@ template<typename T>
 typename moo::vector<T>::self_type&
 moo::vector<T>::operator/=( const value_type& v )
 {
-  for (unsigned int i=0; i!=size(); ++i)
+  for (unsigned int i=0; i!=m_size; ++i)
     m_data[i] /= v;
 
   return *this;
@@ -295,13 +307,13 @@ moo::vector<T>::operator/( const value_type& v ) const
  * \param os The stream in which we write.
  * \param v The vector to write.
  */
-// template<typename T>
-// std::ostream& operator<<( std::ostream& os, const moo::vector<T>& v )
-// {
-//   os << v[0];
+template<typename T>
+std::ostream& operator<<( std::ostream& os, const moo::vector<T>& v )
+{
+  os << (double)v[0];
 
-//   for (unsigned int i=1; i!=v.size(); ++i)
-//     os << '\t' << v[i];
+  for (unsigned int i=1; i!=v.size(); ++i)
+    os << '\t' << (double)v[i];
 
-//   return os;
-// } // operator<<() [vector]
+  return os;
+} // operator<<() [vector]
@@ -0,0 +1,63 @@
+/**
+ * \file moo/object_pool.hpp
+ * \brief A pool of memory for objects of a given type.
+ * \author Julien Jorge
+ */
+#ifndef __MOO_OBJECT_POOL_HPP__
+#define __MOO_OBJECT_POOL_HPP__
+
+#include <cstddef>
+#include <vector>
+
+namespace moo
+{
+  /**
+   * \brief A pool of memory for objects of a given type.
+   *
+   * The memory is reserved by blocks of objects and the released objects are
+   * kept in a free list, so the pool does not call the allocator anymore once
+   * it has grown to the size of its peak use. The objects are built in the
+   * memory returned by allocate() with the placement new, and given back with
+   * destroy(). The memory of the objects still alive is reclaimed by the
+   * destructor of the pool, without calling their destructor.
+   *
+   * \author Julien Jorge
+   */
+  template<typename T>
+  class object_pool
+  {
+  public:
+    explicit object_pool( std::size_t block_size = 256 );
+    ~object_pool();
+
+    void* allocate();
+    void destroy( T* p );
+
+  private:
+    object_pool( const object_pool<T>& that );
+    object_pool<T>& operator=( const object_pool<T>& that );
+
+    void add_block();
+
+  private:
+    /** \brief The size of a slot, large enough for a T and for a link of the
+        free list, rounded to the alignment of a double. */
+    static const std::size_t s_slot_size =
+      ( ( (sizeof(T) > sizeof(void*)) ? sizeof(T) : sizeof(void*) )
+        + sizeof(double) - 1 ) / sizeof(double) * sizeof(double);
+
+    /** \brief The number of objects in a block. */
+    const std::size_t m_block_size;
+
+    /** \brief The blocks of memory. */
+    std::vector<void*> m_blocks;
+
+    /** \brief The first free slot. */
+    void* m_free;
+
+  }; // class object_pool
+} // namespace moo
+
+#include <moo/impl/object_pool.tpp>
+
+#endif // __MOO_OBJECT_POOL_HPP__
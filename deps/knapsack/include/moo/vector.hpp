@@ -6,13 +6,23 @@
 #ifndef __MOO_VECTOR_HPP__
 #define __MOO_VECTOR_HPP__
 
-#include <vector>
 #include <iostream>
 
+/** \brief The maximum size of a moo::vector. The vectors are points of the
+    objective space, so this is the maximum number of objectives. */
+#ifndef MOO_VECTOR_MAX_SIZE
+#define MOO_VECTOR_MAX_SIZE 4
+#endif
+
 namespace moo
 {
   /**
    * \brief Base class for vectors (in a mathematical sense).
+   *
+   * The components are stored in the vector itself, up to MOO_VECTOR_MAX_SIZE
+   * of them, so copying a vector or building the result of an operation does
+   * not allocate memory.
+   *
    * \author Julien Jorge
    */
   template<typename T>
@@ -56,7 +66,12 @@ namespace moo
     inline self_type operator/( const value_type& v ) const;
 
   private:
-    std::vector<value_type> m_data;
+    /** \brief The components of the vector. Only the m_size first ones are
+        used. */
+    value_type m_data[MOO_VECTOR_MAX_SIZE];
+
+    /** \brief The number of components. */
+    unsigned int m_size;
 
   }; // class vector
 } // namespace moo
@@ -22,17 +22,113 @@
 #include "bikp/reduction/variable_fixing_by_bound_set.hpp"
 #include "bikp/reduction/extern_variable_fixing.hpp"
 #include "bikp/reduction/variable_fixing_by_direction.hpp"
+#include "bikp/tool/indexed_priority_queue.hpp"
 
 /*----------------------------------------------------------------------------*/
 /**
  * \brief Constructor.
  */
 base_second_phase::base_second_phase( const std::string& name )
-  : m_logger(name + "_second_phase")
+  : m_logger(name + "_second_phase"), m_time_limit(-1), m_epsilon(0),
+    m_origin(0, 0), m_use_ceiling(false)
 {
 
 } // base_second_phase::base_second_phase()
 
+/*----------------------------------------------------------------------------*/
+/**
+ * \brief Set the maximum duration of run().
+ * \param seconds The duration. There is no limit if it is negative.
+ *
+ * When the limit is reached, the remaining triangles are not explored and the
+ * solutions found up to now are kept, with the supported ones. See
+ * get_unexplored_triangles().
+ */
+void base_second_phase::set_time_limit( double seconds )
+{
+  m_time_limit = seconds;
+} // base_second_phase::set_time_limit()
+
+/*----------------------------------------------------------------------------*/
+/**
+ * \brief Search a (1 + epsilon)-approximation of the front.
+ * \param epsilon The relative tolerance. All the efficient solutions are
+ *        searched if it is zero.
+ *
+ * For each efficient solution z, the solutions found by run() contain a
+ * solution s such that z <= (1 + epsilon) * s on both objectives. The lower
+ * bounds of the triangles are computed with the points scaled by
+ * (1 + epsilon), so the points covered by the ones already found are not
+ * searched. The bounds of the unexplored triangles are on the points that are
+ * not covered.
+ */
+void base_second_phase::set_approximation( double epsilon )
+{
+  m_epsilon = epsilon;
+} // base_second_phase::set_approximation()
+
+/*----------------------------------------------------------------------------*/
+/**
+ * \brief Give some feasible solutions of the problem, found before the next
+ *        call to run(), for example by a previous resolution of a close
+ *        instance.
+ * \param X The feasible solutions. They are inserted in the known points
+ *        before the exploration of the triangles, to tighten their bounds.
+ */
+void base_second_phase::set_known_solutions( const std::list<bi_solution>& X )
+{
+  m_known_solutions = X;
+  m_use_ceiling = false;
+  m_ceiling.clear();
+} // base_second_phase::set_known_solutions()
+
+/*----------------------------------------------------------------------------*/
+/**
+ * \brief Give some feasible solutions of the problem and tell that the other
+ *        efficient points are under some given points.
+ * \param X The feasible solutions. They are inserted in the known points
+ *        before the exploration of the triangles, to tighten their bounds.
+ * \param ceiling Some points such that each efficient point is the image of a
+ *        solution of \a X or is lower than or equal to one of them on both
+ *        objectives.
+ *
+ * The parts of the triangles that are not under a point of \a ceiling are not
+ * explored, and a triangle which has no such part is not explored at all. The
+ * solutions of \a X are then returned with the ones found by run().
+ */
+void base_second_phase::set_known_solutions
+( const std::list<bi_solution>& X, const std::list<bi_profit>& ceiling )
+{
+  m_known_solutions = X;
+  m_use_ceiling = true;
+  m_ceiling.clear();
+
+  std::list<bi_profit>::const_iterator it;
+
+  for ( it=ceiling.begin(); it!=ceiling.end(); ++it )
+    {
+      const combined_triangle::ceiling_type::iterator itc =
+	m_ceiling.find( it->profit_1 );
+
+      if ( itc == m_ceiling.end() )
+	m_ceiling[it->profit_1] = it->profit_2;
+      else if ( it->profit_2 > itc->second )
+	itc->second = it->profit_2;
+    }
+
+  // keep the greatest profit of the points on the right
+  combined_triangle::ceiling_type::reverse_iterator itc;
+  real_type max_2 = 0;
+
+  for ( itc=m_ceiling.rbegin(); itc!=m_ceiling.rend(); ++itc )
+    {
+      if ( (itc == m_ceiling.rbegin()) || (itc->second > max_2) )
+	max_2 = itc->second;
+      else
+	itc->second = max_2;
+    }
+} // base_second_phase::set_known_solutions()
+
 /*----------------------------------------------------------------------------*/
 /**
  * \brief Execute the algorithm.
@@ -44,11 +140,18 @@ void base_second_phase::run
 {
   assert(X_SE.size() >= 2);
 
+  gettimeofday( &m_start_time, NULL );
+  m_unexplored_triangles.clear();
+
   variable_fixing_by_direction red(p, X_SE);
 
   const bi_problem& sub_p = red.get_sub_problem();
   bi_profit guaranteed_profit = red.guaranteed_profit();
 
+  m_origin = guaranteed_profit;
+  m_solution_sets.set_approximation( m_epsilon, m_origin );
+  m_solution_sets.set_ceiling( m_use_ceiling ? &m_ceiling : NULL );
+
   std::cout << "Global reduction from " << p.size() << " to " << sub_p.size()
 	    << " variables."
 	    << std::endl;
@@ -78,6 +181,20 @@ void base_second_phase::run
       red.restore_solution( *it_s, s );
       m_X_NSE.insert(s);
     }
+
+  // the supported solutions are found again only in the explored triangles
+  if ( !m_unexplored_triangles.empty() )
+    {
+      m_X_NSE.insert( X_SE.begin(), X_SE.end() );
+      restore_unexplored_triangles( guaranteed_profit );
+    }
+
+  // the solutions that are not under the ceiling are not found again
+  if ( m_use_ceiling )
+    {
+      m_X_NSE.insert( X_SE.begin(), X_SE.end() );
+      m_X_NSE.insert( m_known_solutions.begin(), m_known_solutions.end() );
+    }
 } // base_second_phase::run()
 
 /*----------------------------------------------------------------------------*/
@@ -90,6 +207,19 @@ base_second_phase::get_solutions() const
   return m_X_NSE;
 } // base_second_phase::get_solutions()
 
+/*----------------------------------------------------------------------------*/
+/**
+ * \brief Get the triangles not explored by the last call to run() because of
+ *        the time limit, in the order in which they would have been explored.
+ *
+ * The efficient solutions missing in get_solutions() are in these triangles.
+ */
+const std::list<base_second_phase::triangle_gap>&
+base_second_phase::get_unexplored_triangles() const
+{
+  return m_unexplored_triangles;
+} // base_second_phase::get_unexplored_triangles()
+
 /*----------------------------------------------------------------------------*/
 /**
  * \brief Save the images of the non supported solutions.
@@ -156,11 +286,59 @@ void base_second_phase::run_solver
 
   pre_sort( triangles );
 
-  unsigned int i = next_triangle_index( triangles );
+  std::list<bi_solution>::const_iterator it_k;
+
+  for ( it_k=m_known_solutions.begin(); it_k!=m_known_solutions.end(); ++it_k )
+    {
+      const bi_profit& z = it_k->objective_value();
+
+      if ( (z.profit_1 >= m_origin.profit_1)
+	   && (z.profit_2 >= m_origin.profit_2) )
+	{
+	  m_pareto_front.insert( z - m_origin );
+	  m_solution_sets.insert( z - m_origin );
+	}
+    }
+
+  // the corners of the triangles, the known solutions and the ceiling
+  // already cover some points
+  if ( (m_epsilon > 0) || !m_known_solutions.empty() || m_use_ceiling )
+    {
+      std::list<triangle> tightened;
+      m_solution_sets.tighten( tightened );
+    }
+
+  // the next triangle is the one with the thinnest strip, the widths are
+  // updated when the lower bounds of the triangles are tightened
+  tool::indexed_priority_queue<real_type> queue( triangles.size() );
+  std::map<real_type, unsigned int> index;
+
+  for (unsigned int i=0; i!=triangles.size(); ++i)
+    {
+      // there is nothing to find in an empty strip
+      if ( m_solution_sets.strip_width(triangles[i]) < 0 )
+	m_solution_sets.lock( triangles[i] );
+      else
+	queue.push( i, m_solution_sets.strip_width(triangles[i]) );
+
+      index[ triangles[i].top_left().profit_1 ] = i;
+    }
+
   unsigned int progress = 1;
 
-  while ( i!=triangles.size() )
+  while ( !queue.empty() && !time_out() )
     {
+      const unsigned int i = queue.top();
+      std::list<triangle> tightened;
+
+      queue.pop();
+
+      if ( m_solution_sets.strip_width(triangles[i]) < 0 )
+	{
+	  m_solution_sets.lock( triangles[i] );
+	  continue;
+	}
+
       m_logger.log() << progress << "/" << triangles.size() << " "
 		     << triangles[i].top_left().profit_1
 		     << ","
@@ -174,56 +352,108 @@ void base_second_phase::run_solver
 		     << ")"
 		     << std::endl;
 
-      calculate_triangle( p, triangles[i] );
+      calculate_triangle( p, triangles[i], tightened );
 
       m_solution_sets.lock( triangles[i] );
 
-      i = next_triangle_index( triangles );
+      std::list<triangle>::const_iterator it;
+
+      for (it=tightened.begin(); it!=tightened.end(); ++it)
+	{
+	  const unsigned int j = index[ it->top_left().profit_1 ];
+
+	  if ( queue.contains(j) )
+	    queue.change_key( j, m_solution_sets.strip_width(triangles[j]) );
+	}
+
       ++progress;
     }
+
+  for ( ; !queue.empty(); queue.pop() )
+    add_unexplored_triangle( triangles[queue.top()] );
 } // base_second_phase::run_solver()
 
 /*----------------------------------------------------------------------------*/
 /**
- * \brief Sort the triangles in the order you want to explore them.
- * \param triangles The triangles to order.
+ * \brief Tell if the time limit of run() is reached.
  */
-void base_second_phase::pre_sort( std::vector<triangle>& triangles ) const
+bool base_second_phase::time_out() const
 {
-  // nothing to do
-} // base_second_phase::save()
+  if ( m_time_limit < 0 )
+    return false;
+
+  timeval now;
+  gettimeofday( &now, NULL );
+
+  const double elapsed = (now.tv_sec - m_start_time.tv_sec)
+    + (now.tv_usec - m_start_time.tv_usec) / 1000000.0;
+
+  return elapsed >= m_time_limit;
+} // base_second_phase::time_out()
 
 /*----------------------------------------------------------------------------*/
-unsigned int base_second_phase::next_triangle_index
-( const std::vector<triangle>& triangles ) const
+/**
+ * \brief Keep a triangle that won't be explored, with its current bounds.
+ * \param t The triangle.
+ */
+void base_second_phase::add_unexplored_triangle( const triangle& t )
 {
-  unsigned int index = triangles.size();
-  real_type w(0);
+  triangle_gap gap;
 
-  for (unsigned int i=0; i!=triangles.size(); ++i)
-    if ( !m_solution_sets.locked( triangles[i] ) )
-      if ( m_solution_sets.strip_width( triangles[i] ) > w )
-	w = m_solution_sets.strip_width( triangles[i] );
+  gap.top_left = t.top_left();
+  gap.bottom_right = t.bottom_right();
+  gap.lower_bound = m_solution_sets.get_lower_bound(t);
+  gap.upper_bound = m_solution_sets.get_upper_bound(t);
 
-  for (unsigned int i=0; i!=triangles.size(); ++i)
-    if ( !m_solution_sets.locked( triangles[i] ) )
-      if ( m_solution_sets.strip_width( triangles[i] ) <= w )
-	{
-	  index = i;
-	  w = m_solution_sets.strip_width( triangles[i] );
-	}
+  m_unexplored_triangles.push_back(gap);
+} // base_second_phase::add_unexplored_triangle()
 
-  return index;
-} // base_second_phase::next_triangle_index()
+/*----------------------------------------------------------------------------*/
+/**
+ * \brief Move the unexplored triangles from the space of the reduced problem
+ *        to the space of the initial problem.
+ * \param delta The profit of the variables fixed by the reduction.
+ */
+void base_second_phase::restore_unexplored_triangles( const bi_profit& delta )
+{
+  std::list<triangle_gap>::iterator it;
+
+  for ( it=m_unexplored_triangles.begin(); it!=m_unexplored_triangles.end();
+	++it )
+    {
+      const real_type lambda_1 =
+	it->top_left.profit_2 - it->bottom_right.profit_2;
+      const real_type lambda_2 =
+	it->bottom_right.profit_1 - it->top_left.profit_1;
+      const real_type shift =
+	lambda_1 * delta.profit_1 + lambda_2 * delta.profit_2;
+
+      it->top_left += delta;
+      it->bottom_right += delta;
+      it->lower_bound += shift;
+      it->upper_bound += shift;
+    }
+} // base_second_phase::restore_unexplored_triangles()
+
+/*----------------------------------------------------------------------------*/
+/**
+ * \brief Sort the triangles in the order you want to explore them.
+ * \param triangles The triangles to order.
+ */
+void base_second_phase::pre_sort( std::vector<triangle>& triangles ) const
+{
+  // nothing to do
+} // base_second_phase::save()
 
 /*----------------------------------------------------------------------------*/
 /**
  * \brief Calculate solutions inside a triangle made by two successive points.
  * \param p The problem to solve.
  * \param t The triangle to solve.
+ * \param tightened (out) The triangles whose lower bound has been updated.
  */
-void
-base_second_phase::calculate_triangle( const bi_problem& p, const triangle& t )
+void base_second_phase::calculate_triangle
+( const bi_problem& p, const triangle& t, std::list<triangle>& tightened )
 {
   std::list<bi_solution> new_solutions;
   combined_problem mono_p(p, t.height(), t.width());
@@ -243,7 +473,7 @@ base_second_phase::calculate_triangle( const bi_problem& p, const triangle& t )
   m_pareto_front.insert( new_solutions.begin(), new_solutions.end() );
   m_pareto_front.insert( out_points.begin(), out_points.end() );
 
-  m_solution_sets.tighten();
+  m_solution_sets.tighten( tightened );
 } // base_second_phase::calculate_triangle()
 
 /*----------------------------------------------------------------------------*/
@@ -293,6 +523,14 @@ void base_second_phase::solve
       combined_triangle_front region
 	( true, z2_opt, z1_opt, lb_lambda, lambda_1, lambda_2 );
 
+      if ( m_epsilon > 0 )
+	region.set_approximation
+	  ( m_epsilon, m_origin + reduction->guaranteed_profit() );
+
+      if ( m_use_ceiling )
+	region.set_ceiling
+	  ( &m_ceiling, m_origin + reduction->guaranteed_profit() );
+
       solve( sub_p, region, sub_sols, sub_out_points );
 
       std::list<combined_solution>::const_iterator it;
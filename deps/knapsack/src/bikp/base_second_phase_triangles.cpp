@@ -35,7 +35,7 @@ base_second_phase::triangle_set::local_point_set::local_point_set()
  */
 base_second_phase::triangle_set::local_point_set::local_point_set
 ( const bi_profit& p1, const bi_profit& p2 )
-  : locked(false), z1(p1), z2(p2)
+  : locked(false), z1(p1), z2(p2), changed(true)
 {
   real_type lambda_1 = z1.profit_2 - z2.profit_2;
   real_type lambda_2 = z2.profit_1 - z1.profit_1;
@@ -52,9 +52,15 @@ base_second_phase::triangle_set::local_point_set::local_point_set
 /*----------------------------------------------------------------------------*/
 /**
  * \brief Calculate the value of the lower bound.
+ * \param epsilon The relative tolerance on the points to find.
+ * \param origin The profit to add to the points to get the profit in the
+ *        initial problem.
+ * \param ceiling The points under which the points to find are, in the
+ *        initial problem. NULL if there is no such constraint.
  */
-void
-base_second_phase::triangle_set::local_point_set::compute_lower_bound()
+void base_second_phase::triangle_set::local_point_set::compute_lower_bound
+( real_type epsilon, const bi_profit& origin,
+  const combined_triangle::ceiling_type* ceiling )
 {
   real_type lambda_1 = z1.profit_2 - z2.profit_2;
   real_type lambda_2 = z2.profit_1 - z1.profit_1;
@@ -64,6 +70,12 @@ base_second_phase::triangle_set::local_point_set::compute_lower_bound()
 
   combined_triangle_front region( true, z_left, z_right, lambda_1, lambda_2 );
 
+  if ( epsilon > 0 )
+    region.set_approximation( epsilon, origin );
+
+  if ( ceiling != NULL )
+    region.set_ceiling( ceiling, origin );
+
   std::list<combined_profit> profits;
   pareto_set<bi_profit>::const_iterator it;
 
@@ -77,6 +89,16 @@ base_second_phase::triangle_set::local_point_set::compute_lower_bound()
 
 
 
+/*----------------------------------------------------------------------------*/
+/**
+ * \brief Constructor.
+ */
+base_second_phase::triangle_set::triangle_set()
+  : m_epsilon(0), m_origin(0, 0), m_ceiling(NULL)
+{
+
+} // base_second_phase::triangle_set::triangle_set()
+
 /*----------------------------------------------------------------------------*/
 /**
  * \brief Destructor.
@@ -164,18 +186,62 @@ void base_second_phase::triangle_set::insert( const bi_profit& s )
       if ( !it->second->locked )
 	if ( s.profit_1 > it->second->z1.profit_1 )
 	  if ( s.profit_2 > it->second->z2.profit_2 )
-	    it->second->point_set.insert(s);
+	    {
+	      it->second->point_set.insert(s);
+	      it->second->changed = true;
+	    }
     }
 } // base_second_phase::triangle_set::insert()
 
 /*----------------------------------------------------------------------------*/
-void base_second_phase::triangle_set::tighten()
+/**
+ * \brief Compute the lower bounds of the triangles for an approximation of the
+ *        front.
+ * \param epsilon The relative tolerance on the points to find.
+ * \param origin The profit to add to the points to get the profit in the
+ *        initial problem.
+ *
+ * \sa combined_triangle::set_approximation()
+ */
+void base_second_phase::triangle_set::set_approximation
+( real_type epsilon, const bi_profit& origin )
+{
+  m_epsilon = epsilon;
+  m_origin = origin;
+} // base_second_phase::triangle_set::set_approximation()
+
+/*----------------------------------------------------------------------------*/
+/**
+ * \brief Compute the lower bounds of the triangles with only the points under
+ *        a ceiling.
+ * \param ceiling The points under which the points to find are, in the
+ *        initial problem. NULL if there is no such constraint.
+ *
+ * \sa combined_triangle::set_ceiling()
+ */
+void base_second_phase::triangle_set::set_ceiling
+( const combined_triangle::ceiling_type* ceiling )
+{
+  m_ceiling = ceiling;
+} // base_second_phase::triangle_set::set_ceiling()
+
+/*----------------------------------------------------------------------------*/
+/**
+ * \brief Update the lower bounds of the triangles in which some points have
+ *        been inserted.
+ * \param tightened (out) The triangles whose lower bound has been updated.
+ */
+void base_second_phase::triangle_set::tighten( std::list<triangle>& tightened )
 {
   point_set_map::const_iterator it;
 
   for ( it=m_triangles.begin(); it!=m_triangles.end(); ++it )
-    if ( !it->second->locked )
-      it->second->compute_lower_bound();
+    if ( !it->second->locked && it->second->changed )
+      {
+	it->second->compute_lower_bound( m_epsilon, m_origin, m_ceiling );
+	it->second->changed = false;
+	tightened.push_back( triangle(it->second->z1, it->second->z2) );
+      }
 } // base_second_phase::triangle_set::tighten()
 
 /*----------------------------------------------------------------------------*/
@@ -198,6 +264,15 @@ base_second_phase::triangle_set::get_lower_bound( const triangle& t ) const
   return m_triangles.find( t.top_left().profit_1 )->second->lower_bound;
 } // base_second_phase::triangle_set::get_lower_bound()
 
+/*----------------------------------------------------------------------------*/
+real_type
+base_second_phase::triangle_set::get_upper_bound( const triangle& t ) const
+{
+  assert( m_triangles.find( t.top_left().profit_1 ) != m_triangles.end() );
+
+  return m_triangles.find( t.top_left().profit_1 )->second->upper_bound;
+} // base_second_phase::triangle_set::get_upper_bound()
+
 /*----------------------------------------------------------------------------*/
 /**
  * \brief Find points that dominate as most already seen triangles as possible.
@@ -21,23 +21,19 @@
 
 #include "bikp/problem/bi_problem.hpp"
 #include "bikp/solver/bi_two_phases.hpp"
+#include "bikp/solver/bi_two_phases_session.hpp"
 #include "bikp/bi2phases.hpp"
 
 /*----------------------------------------------------------------------------*/
 /**
- * \brief Program entry point.
- * \param argc Arguments count.
- * \param argv Program's arguments.
+ * \brief Copy the solutions in the arrays returned to the caller.
+ * \param sz The number of variables of the problem.
+ * \param X_E The solutions.
  */
-extern "C" 
-void bi2phases( int nb_obj, int sz, int *obj1, int *obj2, int *weigths ,int capacity ,int * &z1, int * &z2, int * &solW, bool * &res, int &nbSol)
+static void export_solutions
+( int sz, std::list<bi_solution>& X_E, int * &z1, int * &z2, int * &solW,
+  bool * &res, int &nbSol )
 {
-  bi_problem p(nb_obj, sz, obj1, obj2, weigths ,capacity);
-  bi_two_phases solver;
-  std::list<bi_solution> X_E;
-  
-  solver.run(p, X_E);
-
   X_E.sort();
 
   nbSol = X_E.size();
@@ -62,8 +58,158 @@ void bi2phases( int nb_obj, int sz, int *obj1, int *obj2, int *weigths ,int capa
 
     cptSol++;
   }
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+ * \brief Program entry point.
+ * \param argc Arguments count.
+ * \param argv Program's arguments.
+ */
+extern "C" 
+void bi2phases( int nb_obj, int sz, int *obj1, int *obj2, int *weigths ,int capacity ,int * &z1, int * &z2, int * &solW, bool * &res, int &nbSol)
+{
+  bi_problem p(nb_obj, sz, obj1, obj2, weigths ,capacity);
+  bi_two_phases solver;
+  std::list<bi_solution> X_E;
+  
+  solver.run(p, X_E);
+
+  export_solutions(sz, X_E, z1, z2, solW, res, nbSol);
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+ * \brief Same as bi2phases(), but the solutions are a (1+epsilon)-approximation
+ *        of the front: for each efficient solution z, there is a returned
+ *        solution s such that z <= (1+epsilon) * s on both objectives.
+ */
+extern "C"
+void bi2phases_approx( int nb_obj, int sz, int *obj1, int *obj2, int *weigths ,int capacity, double epsilon, int * &z1, int * &z2, int * &solW, bool * &res, int &nbSol)
+{
+  bi_problem p(nb_obj, sz, obj1, obj2, weigths ,capacity);
+  bi_two_phases solver(epsilon);
+  std::list<bi_solution> X_E;
+
+  solver.run(p, X_E);
 
+  export_solutions(sz, X_E, z1, z2, solW, res, nbSol);
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+ * \brief Same as bi2phases(), but the second phase stops after time_limit
+ *        seconds. The nbGaps triangles not explored are returned in gaps, six
+ *        values per triangle: the top-left corner, the bottom-right corner, then
+ *        the lower and upper bounds on the combined value of the missing points
+ *        (see base_second_phase::triangle_gap).
+ */
+extern "C"
+void bi2phases_anytime( int nb_obj, int sz, int *obj1, int *obj2, int *weigths ,int capacity, double time_limit, int * &z1, int * &z2, int * &solW, bool * &res, int &nbSol, double * &gaps, int &nbGaps)
+{
+  bi_problem p(nb_obj, sz, obj1, obj2, weigths ,capacity);
+  bi_two_phases solver;
+  std::list<bi_solution> X_E;
+  std::list<bi_two_phases::triangle_gap> G;
 
+  solver.run(p, X_E, time_limit, G);
 
+  export_solutions(sz, X_E, z1, z2, solW, res, nbSol);
 
-}
\ No newline at end of file
+  nbGaps = G.size();
+  gaps = new double[6*nbGaps];
+
+  int cptGap = 0;
+  for ( ; !G.empty() ; G.pop_front() )
+  {
+    const bi_two_phases::triangle_gap& g(G.front());
+
+    gaps[6*cptGap] = g.top_left.profit_1;
+    gaps[6*cptGap + 1] = g.top_left.profit_2;
+    gaps[6*cptGap + 2] = g.bottom_right.profit_1;
+    gaps[6*cptGap + 3] = g.bottom_right.profit_2;
+    gaps[6*cptGap + 4] = g.lower_bound;
+    gaps[6*cptGap + 5] = g.upper_bound;
+
+    cptGap++;
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+ * \brief Create a session to solve a problem several times with small changes
+ *        between the resolutions (see bi_two_phases_session). The session must
+ *        be released with bi2phases_session_destroy().
+ */
+extern "C"
+void* bi2phases_session_create( int sz, int *obj1, int *obj2, int *weigths ,int capacity )
+{
+  return new bi_two_phases_session(sz, obj1, obj2, weigths, capacity);
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+ * \brief Change the capacity of the problem of a session.
+ */
+extern "C"
+void bi2phases_session_set_capacity( void *session, int capacity )
+{
+  static_cast<bi_two_phases_session*>(session)->set_capacity(capacity);
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+ * \brief Change the profits and the weight of the item i (from zero) of the
+ *        problem of a session.
+ */
+extern "C"
+void bi2phases_session_set_item( void *session, int i, int p1, int p2, int w )
+{
+  static_cast<bi_two_phases_session*>(session)->set_item(i, p1, p2, w);
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+ * \brief Add an item after the items of the problem of a session.
+ */
+extern "C"
+void bi2phases_session_add_item( void *session, int p1, int p2, int w )
+{
+  static_cast<bi_two_phases_session*>(session)->add_item(p1, p2, w);
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+ * \brief Remove the item i (from zero) of the problem of a session.
+ */
+extern "C"
+void bi2phases_session_remove_item( void *session, int i )
+{
+  static_cast<bi_two_phases_session*>(session)->remove_item(i);
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+ * \brief Same as bi2phases(), on the current problem of a session.
+ */
+extern "C"
+void bi2phases_session_solve( void *session, int * &z1, int * &z2, int * &solW, bool * &res, int &nbSol)
+{
+  bi_two_phases_session* s = static_cast<bi_two_phases_session*>(session);
+
+  s->run();
+
+  std::list<bi_solution> X_E( s->get_solutions() );
+
+  export_solutions(s->get_problem().size(), X_E, z1, z2, solW, res, nbSol);
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+ * \brief Release a session created by bi2phases_session_create().
+ */
+extern "C"
+void bi2phases_session_destroy( void *session )
+{
+  delete static_cast<bi_two_phases_session*>(session);
+}
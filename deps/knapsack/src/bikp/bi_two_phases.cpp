@@ -22,15 +22,58 @@
 #include "bikp/phase/dp_first_phase.hpp"
 #include "bikp/phase/klp_second_phase.hpp"
 
+#include <algorithm>
+
+/*----------------------------------------------------------------------------*/
+/**
+ * \brief Constructor.
+ * \param epsilon The relative tolerance of the approximation of the front. For
+ *        each efficient solution z, the solutions found contain a solution s
+ *        such that z <= (1 + epsilon) * s. All the efficient solutions are
+ *        found if it is zero.
+ */
+bi_two_phases::bi_two_phases( double epsilon )
+  : m_epsilon(epsilon)
+{
+
+} // bi_two_phases::bi_two_phases()
+
 /*----------------------------------------------------------------------------*/
 /**
- * \brief 
+ * \brief Compute the efficient solutions of a problem.
+ * \param p The problem to solve.
+ * \param sols (out) The efficient solutions.
  */
 void
 bi_two_phases::run( const bi_problem& p, std::list<bi_solution>& sols ) const
+{
+  std::list<triangle_gap> gaps;
+
+  run( p, sols, -1, gaps );
+} // bi_two_phases::run()
+
+/*----------------------------------------------------------------------------*/
+/**
+ * \brief Compute the efficient solutions of a problem in a limited time.
+ * \param p The problem to solve.
+ * \param sols (out) The efficient solutions found.
+ * \param time_limit The maximum duration of the computation, in seconds. There
+ *        is no limit if it is negative.
+ * \param gaps (out) The triangles of the second phase not explored before the
+ *        time limit, in which the missing efficient solutions are.
+ *
+ * The first phase is always completed, thus the supported solutions are in
+ * \a sols even if the time limit is reached before.
+ */
+void bi_two_phases::run
+( const bi_problem& p, std::list<bi_solution>& sols, double time_limit,
+  std::list<triangle_gap>& gaps ) const
 {
   typedef optimal_set<bi_problem::solution_type> optimal_set_type;
 
+  timeval start;
+  gettimeofday( &start, NULL );
+
   dp_first_phase phase_1;
 
   phase_1.run(p);
@@ -47,9 +90,24 @@ bi_two_phases::run( const bi_problem& p, std::list<bi_solution>& sols ) const
 
       klp_second_phase phase_2 = klp_second_phase();
 
+      phase_2.set_approximation( m_epsilon );
+
+      if ( time_limit >= 0 )
+	{
+	  timeval now;
+	  gettimeofday( &now, NULL );
+
+	  const double elapsed = (now.tv_sec - start.tv_sec)
+	    + (now.tv_usec - start.tv_usec) / 1000000.0;
+
+	  phase_2.set_time_limit( std::max(0.0, time_limit - elapsed) );
+	}
+
       phase_2.run(p, X_SE);
 
       sols.insert( sols.begin(), phase_2.get_solutions().begin(), phase_2.get_solutions().end() );
+      gaps.insert( gaps.end(), phase_2.get_unexplored_triangles().begin(),
+		   phase_2.get_unexplored_triangles().end() );
     }
   else
     sols.insert( sols.begin(), efficient_solutions.begin(), efficient_solutions.end() );
@@ -0,0 +1,317 @@
+/*
+  Copyright Facult des Sciences et Techniques de Nantes
+  contributor:
+    Julien Jorge <julien.jorge@univ-nantes.fr>
+
+  This software is a computer program whose purpose is to exactly solve
+  instances of the bi-objective unidimensional 0-1 knapsack problem.
+
+  This software is governed by the CeCILL license under French law and
+  abiding by the rules of distribution of free software.  You can  use, 
+  modify and/ or redistribute the software under the terms of the CeCILL
+  license as circulated by CEA, CNRS and INRIA at the following URL
+  "http://www.cecill.info". 
+*/
+/**
+ * \file bi_two_phases_session.cpp
+ * \brief Implementation of the bi_two_phases_session class.
+ * \author Julien Jorge
+ */
+#include "bikp/solver/bi_two_phases_session.hpp"
+
+#include "bikp/phase/dp_first_phase.hpp"
+#include "bikp/phase/klp_second_phase.hpp"
+
+#include <algorithm>
+#include <cassert>
+
+/*----------------------------------------------------------------------------*/
+/**
+ * \brief Constructor.
+ * \param sz The number of items.
+ * \param obj1 The profits of the items on the first objective.
+ * \param obj2 The profits of the items on the second objective.
+ * \param weigths The weights of the items.
+ * \param capacity The capacity of the knapsack.
+ */
+bi_two_phases_session::bi_two_phases_session
+( int sz, const int* obj1, const int* obj2, const int* weigths, int capacity )
+  : m_profit_1(obj1, obj1 + sz), m_profit_2(obj2, obj2 + sz),
+    m_weight(weigths, weigths + sz), m_capacity(capacity),
+    m_previous_index(sz, -1), m_relaxed(true), m_problem(NULL)
+{
+
+} // bi_two_phases_session::bi_two_phases_session()
+
+/*----------------------------------------------------------------------------*/
+/**
+ * \brief Destructor.
+ */
+bi_two_phases_session::~bi_two_phases_session()
+{
+  m_solutions.clear();
+  delete m_problem;
+} // bi_two_phases_session::~bi_two_phases_session()
+
+/*----------------------------------------------------------------------------*/
+/**
+ * \brief Change the capacity of the knapsack.
+ * \param capacity The new capacity.
+ */
+void bi_two_phases_session::set_capacity( int capacity )
+{
+  if ( capacity > m_capacity )
+    m_relaxed = true;
+
+  m_capacity = capacity;
+} // bi_two_phases_session::set_capacity()
+
+/*----------------------------------------------------------------------------*/
+/**
+ * \brief Change the profits and the weight of an item.
+ * \param i The index of the item.
+ * \param p1 The new profit on the first objective.
+ * \param p2 The new profit on the second objective.
+ * \param w The new weight.
+ */
+void bi_two_phases_session::set_item( unsigned int i, int p1, int p2, int w )
+{
+  assert( i < m_weight.size() );
+
+  if ( (p1 > m_profit_1[i]) || (p2 > m_profit_2[i]) || (w < m_weight[i]) )
+    m_relaxed = true;
+
+  m_profit_1[i] = p1;
+  m_profit_2[i] = p2;
+  m_weight[i] = w;
+} // bi_two_phases_session::set_item()
+
+/*----------------------------------------------------------------------------*/
+/**
+ * \brief Add an item after the current ones.
+ * \param p1 The profit on the first objective.
+ * \param p2 The profit on the second objective.
+ * \param w The weight.
+ */
+void bi_two_phases_session::add_item( int p1, int p2, int w )
+{
+  m_relaxed = true;
+
+  m_profit_1.push_back(p1);
+  m_profit_2.push_back(p2);
+  m_weight.push_back(w);
+  m_previous_index.push_back(-1);
+} // bi_two_phases_session::add_item()
+
+/*----------------------------------------------------------------------------*/
+/**
+ * \brief Remove an item. The index of the next items is decreased by one.
+ * \param i The index of the item.
+ */
+void bi_two_phases_session::remove_item( unsigned int i )
+{
+  assert( i < m_weight.size() );
+
+  m_profit_1.erase( m_profit_1.begin() + i );
+  m_profit_2.erase( m_profit_2.begin() + i );
+  m_weight.erase( m_weight.begin() + i );
+  m_previous_index.erase( m_previous_index.begin() + i );
+} // bi_two_phases_session::remove_item()
+
+/*----------------------------------------------------------------------------*/
+/**
+ * \brief Compute the efficient solutions of the current problem, with the
+ *        help of the solutions of the previous resolution.
+ */
+void bi_two_phases_session::run()
+{
+  // the vectors have no element to point to once all the items are removed
+  const bool empty = m_weight.empty();
+
+  bi_problem* p = new bi_problem
+    ( 2, m_weight.size(), empty ? NULL : &m_profit_1[0],
+      empty ? NULL : &m_profit_2[0], empty ? NULL : &m_weight[0], m_capacity );
+
+  std::list<bi_solution> seeds;
+  std::list<bi_profit> lost;
+  std::list<bi_solution> X_SE;
+  std::list<bi_profit> Z_SE;
+
+  convert_solutions( *p, seeds, lost );
+
+  // the only solution of a problem without items is the empty knapsack
+  if ( empty )
+    X_SE.push_back( bi_solution(*p) );
+  else if ( !find_supported_solutions( seeds, lost, X_SE ) )
+    {
+      typedef optimal_set<bi_problem::solution_type> optimal_set_type;
+
+      dp_first_phase phase_1;
+
+      phase_1.run(*p);
+
+      optimal_set_type efficient_solutions( phase_1.get_extreme_solutions() );
+      efficient_solutions.insert( phase_1.get_not_extreme_solutions() );
+
+      X_SE.assign( efficient_solutions.begin(), efficient_solutions.end() );
+    }
+
+  std::list<bi_solution>::const_iterator it;
+
+  for ( it=X_SE.begin(); it!=X_SE.end(); ++it )
+    Z_SE.push_back( it->objective_value() );
+
+  std::list<bi_solution> sols;
+
+  // when the changes are restrictive, the efficient points which are not
+  // images of the seeds are under the lost ones
+  const bool restricted = (m_problem != NULL) && !m_relaxed;
+
+  if ( X_SE.size() >= 2 )
+    {
+      if ( restricted && lost.empty() )
+	{
+	  maximum_complete_set<bi_solution> front;
+
+	  front.insert( X_SE.begin(), X_SE.end() );
+	  front.insert( seeds.begin(), seeds.end() );
+	  sols.assign( front.begin(), front.end() );
+	}
+      else
+	{
+	  klp_second_phase phase_2;
+
+	  if ( restricted )
+	    phase_2.set_known_solutions( seeds, lost );
+	  else
+	    phase_2.set_known_solutions( seeds );
+
+	  phase_2.run(*p, X_SE);
+
+	  sols.assign
+	    ( phase_2.get_solutions().begin(), phase_2.get_solutions().end() );
+	}
+    }
+  else
+    sols.swap( X_SE );
+
+  m_solutions.swap( sols );
+  m_supported.swap( Z_SE );
+
+  // the previous solutions point to the previous problem
+  sols.clear();
+  delete m_problem;
+  m_problem = p;
+
+  for ( unsigned int i=0; i!=m_previous_index.size(); ++i )
+    m_previous_index[i] = i;
+
+  m_relaxed = false;
+} // bi_two_phases_session::run()
+
+/*----------------------------------------------------------------------------*/
+/**
+ * \brief Get the problem of the last resolution.
+ * \pre run() has been called.
+ */
+const bi_problem& bi_two_phases_session::get_problem() const
+{
+  assert( m_problem != NULL );
+
+  return *m_problem;
+} // bi_two_phases_session::get_problem()
+
+/*----------------------------------------------------------------------------*/
+/**
+ * \brief Get the efficient solutions computed by the last resolution.
+ */
+const std::list<bi_solution>& bi_two_phases_session::get_solutions() const
+{
+  return m_solutions;
+} // bi_two_phases_session::get_solutions()
+
+/*----------------------------------------------------------------------------*/
+/**
+ * \brief Build the solutions of the current problem corresponding to the
+ *        solutions of the previous resolution.
+ * \param p The current problem.
+ * \param seeds (out) The solutions that are still feasible.
+ * \param lost (out) The images of the previous solutions that are no longer
+ *        feasible or whose image has changed.
+ */
+void bi_two_phases_session::convert_solutions
+( const bi_problem& p, std::list<bi_solution>& seeds,
+  std::list<bi_profit>& lost ) const
+{
+  std::list<bi_solution>::const_iterator it;
+
+  for ( it=m_solutions.begin(); it!=m_solutions.end(); ++it )
+    {
+      int weight = 0;
+
+      for ( unsigned int i=0; i!=m_previous_index.size(); ++i )
+	if ( (m_previous_index[i] >= 0) && it->is_set(m_previous_index[i]) )
+	  weight += m_weight[i];
+
+      if ( weight > m_capacity )
+	lost.push_back( it->objective_value() );
+      else
+	{
+	  bi_solution s(p);
+
+	  for ( unsigned int i=0; i!=m_previous_index.size(); ++i )
+	    if ( (m_previous_index[i] >= 0)
+		 && it->is_set(m_previous_index[i]) )
+	      s.set(i);
+	    else
+	      s.unset(i);
+
+	  if ( s.objective_value() != it->objective_value() )
+	    lost.push_back( it->objective_value() );
+
+	  seeds.push_back(s);
+	}
+    }
+} // bi_two_phases_session::convert_solutions()
+
+/*----------------------------------------------------------------------------*/
+/**
+ * \brief Get the supported solutions of the current problem without running
+ *        the first phase, if possible.
+ * \param seeds The solutions of the previous resolution, still feasible.
+ * \param lost The images of the previous solutions that have been lost.
+ * \param X_SE (out) A solution for each supported point, by increasing profit
+ *        on the first objective.
+ * \return false if the first phase must be run.
+ *
+ * When the changes can only remove some feasible solutions or decrease their
+ * profits, the images are inside the previous convex hull. If the solutions of
+ * the previous supported points are still there with the same image, then the
+ * supported points have not changed.
+ */
+bool bi_two_phases_session::find_supported_solutions
+( const std::list<bi_solution>& seeds, const std::list<bi_profit>& lost,
+  std::list<bi_solution>& X_SE ) const
+{
+  if ( (m_problem == NULL) || m_relaxed || m_supported.empty() )
+    return false;
+
+  std::list<bi_profit>::const_iterator it_z;
+
+  for ( it_z=m_supported.begin(); it_z!=m_supported.end(); ++it_z )
+    if ( std::find( lost.begin(), lost.end(), *it_z ) != lost.end() )
+      return false;
+
+  for ( it_z=m_supported.begin(); it_z!=m_supported.end(); ++it_z )
+    {
+      std::list<bi_solution>::const_iterator it = seeds.begin();
+
+      while ( (it != seeds.end()) && (it->objective_value() != *it_z) )
+	++it;
+
+      assert( it != seeds.end() );
+      X_SE.push_back( *it );
+    }
+
+  return true;
+} // bi_two_phases_session::find_supported_solutions()
@@ -58,7 +58,7 @@ combined_problem::combined_problem( unsigned int n, const weight_type cap )
 /*----------------------------------------------------------------------------*/
 /**
  * \brief Set the profit & weigth of a variable.
- * \param i The index of the variable.
+ * \param i The index of the variable in the parent problem.
  * \param p The profit of the variable.
  * \param w The weight of the variable.
  */
@@ -68,9 +68,11 @@ void combined_problem::set_variable
   assert( i < size() );
   assert( w >= 0 );
 
-  m_profit[i] = p;
-  m_weight[i] = w;
-  m_efficiency[i] = (real_type)p.lambda / (real_type)w;
+  const std::size_t local = m_local_index[i];
+
+  m_profit[local] = p;
+  m_weight[local] = w;
+  m_efficiency[local] = (real_type)p.lambda / (real_type)w;
 } // combined_problem::set_variable()
 
 /*----------------------------------------------------------------------------*/
@@ -117,3 +119,17 @@ combined_problem::weight_type combined_problem::capacity() const
 {
   return m_capacity;
 } // combined_problem::capacity()
+
+/*----------------------------------------------------------------------------*/
+/**
+ * \brief Sort the variables by decreasing efficiency.
+ */
+void combined_problem::sort_by_decreasing_efficiency()
+{
+  const std::vector<std::size_t> previous( m_local_index );
+
+  super::sort_by_decreasing_efficiency();
+
+  reorder( m_profit, previous );
+  reorder( m_weight, previous );
+} // combined_problem::sort_by_decreasing_efficiency()
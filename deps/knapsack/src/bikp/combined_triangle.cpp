@@ -19,7 +19,9 @@
  */
 #include "bikp/region/combined_triangle.hpp"
 
+#include <cmath>
 #include <fstream>
+#include <list>
 
 /*----------------------------------------------------------------------------*/
 /**
@@ -37,7 +39,8 @@ combined_triangle::combined_triangle
   real_type lambda_1, real_type lambda_2 )
   : m_keep_equivalence(keep_equivalence), m_top_left(top_left),
     m_bottom_right(bottom_right), m_combined_min(combined_min),
-    m_lambda_1(lambda_1), m_lambda_2(lambda_2)
+    m_lambda_1(lambda_1), m_lambda_2(lambda_2), m_epsilon(0), m_origin(0, 0),
+    m_ceiling(NULL)
 {
   assert( top_left.profit_1 < bottom_right.profit_1 );
   assert( top_left.profit_2 > bottom_right.profit_2 );
@@ -77,7 +80,8 @@ combined_triangle::combined_triangle
   const profit_type& bottom_right, real_type lambda_1,
   real_type lambda_2 )
   : m_keep_equivalence(keep_equivalence), m_top_left(top_left),
-    m_bottom_right(bottom_right), m_lambda_1(lambda_1), m_lambda_2(lambda_2)
+    m_bottom_right(bottom_right), m_lambda_1(lambda_1), m_lambda_2(lambda_2),
+    m_epsilon(0), m_origin(0, 0), m_ceiling(NULL)
 {
   assert( top_left.profit_1 < bottom_right.profit_1 );
   assert( top_left.profit_2 > bottom_right.profit_2 );
@@ -166,9 +170,122 @@ combined_triangle& combined_triangle::operator=( const self_type& that )
   assert( m_lambda_2 == that.m_lambda_2 );
 
   m_combined_min = that.m_combined_min;
+  m_epsilon = that.m_epsilon;
+  m_origin = that.m_origin;
+  m_ceiling = that.m_ceiling;
   return *this;
 } // combined_triangle::operator=()
 
+/*----------------------------------------------------------------------------*/
+/**
+ * \brief Search only the points that are not covered within a relative
+ *        tolerance by the known points.
+ *
+ * A point z of the region is covered by a point p if, in the initial problem,
+ * z <= (1 + epsilon) * p on both objectives. The corners cover some points
+ * too, thus the region is tightened right away.
+ *
+ * \param epsilon The relative tolerance.
+ * \param origin The profit to add to the points of the region to get the
+ *        profit in the initial problem.
+ */
+void combined_triangle::set_approximation
+( real_type epsilon, const bi_profit& origin )
+{
+  const std::list<profit_type> no_points;
+
+  m_epsilon = epsilon;
+  m_origin = origin;
+
+  tighten( no_points.begin(), no_points.end() );
+} // combined_triangle::set_approximation()
+
+/*----------------------------------------------------------------------------*/
+/**
+ * \brief Search only the points lower than or equal to a point of a set.
+ *
+ * The lower bound ignores the parts of the region that are above the ceiling,
+ * in which there is nothing to find. If the whole region is above it, the bound
+ * is above the segment between the corners.
+ *
+ * \param ceiling The points of the initial problem under which the points to
+ *        find are. The region keeps a pointer on it. NULL removes the
+ *        constraint.
+ * \param origin The profit to add to the points of the region to get the
+ *        profit in the initial problem.
+ */
+void combined_triangle::set_ceiling
+( const ceiling_type* ceiling, const bi_profit& origin )
+{
+  const std::list<profit_type> no_points;
+
+  m_ceiling = ceiling;
+  m_origin = origin;
+
+  tighten( no_points.begin(), no_points.end() );
+} // combined_triangle::set_ceiling()
+
+/*----------------------------------------------------------------------------*/
+/**
+ * \brief Get the greatest point covered by a given point.
+ * \param p The point.
+ */
+combined_triangle::profit_type
+combined_triangle::scale( const profit_type& p ) const
+{
+  const double factor = 1 + (double)m_epsilon;
+  const double o_1 = m_origin.profit_1;
+  const double o_2 = m_origin.profit_2;
+
+  return profit_type
+    ( m_lambda_1, m_lambda_2,
+      std::floor( factor * ((double)p.profit_1 + o_1) ) - o_1,
+      std::floor( factor * ((double)p.profit_2 + o_2) ) - o_2 );
+} // combined_triangle::scale()
+
+/*----------------------------------------------------------------------------*/
+/**
+ * \brief Tell if a point of the region is lower than or equal to a point of
+ *        the ceiling.
+ * \param x The profit of the point on the first objective.
+ * \param y The profit of the point on the second objective.
+ */
+bool combined_triangle::under_ceiling( real_type x, real_type y ) const
+{
+  if ( m_ceiling == NULL )
+    return true;
+
+  const ceiling_type::const_iterator it =
+    m_ceiling->lower_bound( x + m_origin.profit_1 );
+
+  return (it != m_ceiling->end()) && (it->second >= y + m_origin.profit_2);
+} // combined_triangle::under_ceiling()
+
+/*----------------------------------------------------------------------------*/
+/**
+ * \brief Decrease a value down to the combined objective of a point, if there
+ *        can be a point to find there.
+ * \param val (in/out) The value to decrease.
+ * \param found (in/out) Tell if \a val has been set by a previous call. Set to
+ *        true if \a val is set by this call.
+ * \param x The profit of the point on the first objective.
+ * \param y The profit of the point on the second objective.
+ */
+void combined_triangle::lower
+( real_type& val, bool& found, real_type x, real_type y ) const
+{
+  if ( under_ceiling(x, y) )
+    {
+      const real_type m = m_lambda_1 * x + m_lambda_2 * y;
+
+      if ( !found || (m < val) )
+	{
+	  val = m;
+	  found = true;
+	}
+    }
+} // combined_triangle::lower()
+
 /*----------------------------------------------------------------------------*/
 /**
  * \brief Print a gnuplot description of the region.
@@ -21,31 +21,18 @@
 
 /*----------------------------------------------------------------------------*/
 /**
- * \brief Copy Constructor.
+ * \brief Constructor.
  * \param that the set to copy from.
  * \param v The vertex to be added to \a that.
- * \remark \a that must be dynamically allocated.
  */
 k_longest_paths::vertex_set::vertex_set
-( const vertex_set* that, const vertex_type& v )
+( vertex_set* that, const vertex_type& v )
   : m_links(1), m_parent(that), m_turning(v)
 {
   if (m_parent)
-    const_cast<vertex_set*>(m_parent)->add_link();
+    m_parent->add_link();
 } // k_longest_paths::vertex_set::vertex_set()
 
-/*----------------------------------------------------------------------------*/
-/**
- * \brief Desctructor.
- */
-k_longest_paths::vertex_set::~vertex_set()
-{
-  assert( m_links == 0 );
-
-  if (m_parent)
-    const_cast<vertex_set*>(m_parent)->remove_link();
-} // k_longest_paths::vertex_set::~vertex_set()
-
 /*----------------------------------------------------------------------------*/
 /**
  * \brief Get the vertices in the set.
@@ -54,13 +41,13 @@ k_longest_paths::vertex_set::~vertex_set()
  */
 void k_longest_paths::vertex_set::get_vertices( set_type& vertices ) const
 {
-  assert( vertices.empty() ? true
-	  : m_turning.index() > vertices.front()->index() );
-
-  vertices.push_front( &m_turning );
+  for ( const vertex_set* s = this; s != NULL; s = s->m_parent )
+    {
+      assert( vertices.empty() ? true
+              : s->m_turning.index() > vertices.front()->index() );
 
-  if ( m_parent )
-    m_parent->get_vertices( vertices );
+      vertices.push_front( &s->m_turning );
+    }
 } // k_longest_paths::vertex_set::get_vertices()
 
 /*----------------------------------------------------------------------------*/
@@ -75,12 +62,12 @@ k_longest_paths::vertex_set::last_vertex() const
 
 /*----------------------------------------------------------------------------*/
 /**
- * \brief Release this instance.
+ * \brief Get the set of which this one is an extension.
  */
-void k_longest_paths::vertex_set::release()
+k_longest_paths::vertex_set* k_longest_paths::vertex_set::parent() const
 {
-  remove_link();
-} // k_longest_paths::vertex_set::release()
+  return m_parent;
+} // k_longest_paths::vertex_set::parent()
 
 /*----------------------------------------------------------------------------*/
 /**
@@ -94,25 +81,20 @@ void k_longest_paths::vertex_set::add_link()
 /*----------------------------------------------------------------------------*/
 /**
  * \brief Remove a link to this set.
+ * \return true if there is no more link to this set.
  */
-void k_longest_paths::vertex_set::remove_link()
+bool k_longest_paths::vertex_set::remove_link()
 {
   assert( m_links > 0 );
 
   --m_links;
 
-  if (m_links == 0)
-    delete this;
+  return m_links == 0;
 } // k_longest_paths::vertex_set::remove_link()
 
 
 
 
-// counters of instances of the path class.
-unsigned int k_longest_paths::path::inst_count;
-unsigned int k_longest_paths::path::inst_count_max;
-unsigned int k_longest_paths::path::current;
-
 /*----------------------------------------------------------------------------*/
 /**
  * \brief Constructor.
@@ -131,39 +113,19 @@ k_longest_paths::path::path( const vertex_type& r )
 /**
  * \brief Constructor.
  * \param that The parent path.
- * \param t The out-vertex to take to quit the path.
+ * \param s The out-vertices of \a that plus the one to take to quit the path.
  * \param p The profit of this path.
  *
  * Paths made with this constructor have one more out-vertex compared to their
  * parent path. They represent non-optimal paths starting from the vertex \a r.
- *
- * \pre that.make() has been called.
  */
 k_longest_paths::path::path
-( const path& that, const vertex_type& t, const combined_profit& p )
-  : m_vertices(new vertex_set(that.m_vertices, t)), m_root(that.m_root),
-    m_profit(p)
+( const path& that, vertex_set* s, const combined_profit& p )
+  : m_vertices(s), m_root(that.m_root), m_profit(p)
 {
-  /*if ( ++inst_count > inst_count_max )
-    inst_count_max = inst_count;
-
-    if ( inst_count % 100 == 0 )
-    std::cout << inst_count << " (max " << inst_count_max << ") "
-    << current << std::endl;*/
+  assert( s->parent() == that.m_vertices );
 } // k_longest_paths::path::path()
 
-/*----------------------------------------------------------------------------*/
-/**
- * \brief Destructor.
- */
-k_longest_paths::path::~path()
-{
-  //--inst_count;
-
-  if (m_vertices)
-    m_vertices->release();
-} // k_longest_paths::path::~path()
-
 /*----------------------------------------------------------------------------*/
 /**
  * \brief Get the vertices in the path.
@@ -208,6 +170,15 @@ const k_longest_paths::vertex_type& k_longest_paths::path::last_vertex() const
     return m_vertices->last_vertex();
 } // k_longest_paths::path::last_vertex()
 
+/*----------------------------------------------------------------------------*/
+/**
+ * \brief Get the out-vertices of the path.
+ */
+k_longest_paths::vertex_set* k_longest_paths::path::vertices() const
+{
+  return m_vertices;
+} // k_longest_paths::path::vertices()
+
 
 
 
@@ -253,7 +224,7 @@ k_longest_paths::~k_longest_paths()
       quality_table_value_type::iterator it;
       
       for ( it=it_1->second.begin(); it!=it_1->second.end(); ++it,++i )
-	delete *it;
+	delete_path(*it);
     }
 
   if (m_graph != NULL)
@@ -273,13 +244,16 @@ void k_longest_paths::build_graph()
   const graph_type::layer_type& layer = m_graph->get_layer(m_problem.size());
   const real_type min_profit( (real_type)m_paths_region.min_profit() );
 
-  for ( unsigned int i=0; i!=layer.size(); ++i )
-    if ( (real_type)layer[i]->profit() >= min_profit )
+  // the paths are stacked, so the layer is read backward to explore the
+  // vertices in increasing order of their weight
+  for ( unsigned int i=layer.size(); i!=0; --i )
+    if ( (real_type)layer[i-1]->profit() >= min_profit )
       {
-	m_quality_table[ layer[i]->profit() ].push_back( new path(*layer[i]) );
+	m_quality_table[ layer[i-1]->profit() ].push_back
+          ( new_path(*layer[i-1]) );
 
-	if ( !m_paths_region.contains(layer[i]->profit()) )
-	  m_out_profits.insert(layer[i]->profit());
+	if ( !m_paths_region.contains(layer[i-1]->profit()) )
+	  m_out_profits.insert(layer[i-1]->profit());
       }
 } // k_longest_paths::build_graph()
 
@@ -327,8 +301,8 @@ void k_longest_paths::build_solutions()
                   ref_date = now;
                 }
 #endif
-	      path* p = it->second.front();
-	      it->second.pop_front();
+	      path* p = it->second.back();
+	      it->second.pop_back();
 
 	      if ( !m_paths_region.contains( p->profit() ) )
                 build_next_path(*p);
@@ -339,7 +313,7 @@ void k_longest_paths::build_solutions()
 		  add_solution( sol );
 		}
 	    
-	      delete p;
+	      delete_path(p);
 	    }
 
 	  m_quality_table.erase(it);
@@ -537,19 +511,18 @@ void k_longest_paths::add_path
     {
       if ( m_paths_region.contains(profit) )
         {
-          path* new_path = new path(p, *s, profit);
           m_paths_region.insert(profit);
-          m_quality_table[profit].push_front( new_path );
+          m_quality_table[profit].push_back( new_path(p, *s, profit) );
 
           if ( (real_type)m_paths_region.min_profit() > region_min_profit )
             clear_table();
         }
       else if ( m_paths_region.contains(max_profit) )
         {
-          path* new_path = new path(p, *s, profit);
+          path* next = new_path(p, *s, profit);
           m_out_profits.insert(profit);
-          build_next_path(*new_path);
-          delete new_path;
+          build_next_path(*next);
+          delete_path(next);
         }
       else
         m_out_profits.insert(profit);
@@ -572,10 +545,56 @@ void k_longest_paths::clear_table()
     if ( it->first >= lower_bound )
       stop = true;
     else
-      for ( ; !it->second.empty(); it->second.pop_front() )
-        delete it->second.front();
+      for ( ; !it->second.empty(); it->second.pop_back() )
+        delete_path( it->second.back() );
 } // k_longest_paths::clear_table()
 
+/*----------------------------------------------------------------------------*/
+/**
+ * \brief Create an optimal path starting from a given vertex.
+ * \param r The root of the path.
+ */
+k_longest_paths::path* k_longest_paths::new_path( const vertex_type& r )
+{
+  return new (m_path_pool.allocate()) path(r);
+} // k_longest_paths::new_path()
+
+/*----------------------------------------------------------------------------*/
+/**
+ * \brief Create a path with one more out-vertex than an other path.
+ * \param that The parent path.
+ * \param t The out-vertex to take to quit the path.
+ * \param p The profit of the new path.
+ */
+k_longest_paths::path* k_longest_paths::new_path
+( const path& that, const vertex_type& t, const combined_profit& p )
+{
+  vertex_set* s =
+    new (m_vertex_set_pool.allocate()) vertex_set(that.vertices(), t);
+
+  return new (m_path_pool.allocate()) path(that, s, p);
+} // k_longest_paths::new_path()
+
+/*----------------------------------------------------------------------------*/
+/**
+ * \brief Delete a path and the sets of out-vertices that are not used
+ *        anymore.
+ * \param p The path to delete.
+ */
+void k_longest_paths::delete_path( path* p )
+{
+  vertex_set* s = p->vertices();
+
+  while ( (s != NULL) && s->remove_link() )
+    {
+      vertex_set* parent = s->parent();
+      m_vertex_set_pool.destroy(s);
+      s = parent;
+    }
+
+  m_path_pool.destroy(p);
+} // k_longest_paths::delete_path()
+
 /*----------------------------------------------------------------------------*/
 /**
  * \brief Set the value of a variable in the solution.
@@ -26,18 +26,15 @@
  * \param cap The capacity of the knapsack.
  */
 mono_problem::mono_problem( unsigned int n, weight_type cap )
-  : super(n), m_profit(n), m_weight(n), m_capacity(cap), m_local_index(n)
+  : super(n), m_profit(n), m_weight(n), m_capacity(cap)
 {
   assert( cap >= 0 );
-
-  for (unsigned int i=0; i!=this->m_correspondence.size(); ++i)
-    m_local_index[ this->m_correspondence[i] ] = i;
 } // mono_problem::mono_problem()
 
 /*----------------------------------------------------------------------------*/
 /**
  * \brief Set the profit & weigth of a variable.
- * \param i The index of the variable.
+ * \param i The index of the variable in the parent problem.
  * \param p The profit of the variable.
  * \param w The weight of the variable.
  */
@@ -47,9 +44,11 @@ void mono_problem::set_variable
   assert( i < size() );
   assert( w >= 0 );
 
-  m_profit[i] = p;
-  m_weight[i] = w;
-  m_efficiency[i] = (real_type)p / (real_type)w;
+  const std::size_t local = m_local_index[i];
+
+  m_profit[local] = p;
+  m_weight[local] = w;
+  m_efficiency[local] = (real_type)p / (real_type)w;
 } // mono_problem::set_variable()
 
 /*----------------------------------------------------------------------------*/
@@ -90,8 +89,10 @@ unsigned int mono_problem::local_index( unsigned int index ) const
  */
 void mono_problem::sort_by_decreasing_efficiency()
 {
+  const std::vector<std::size_t> previous( m_local_index );
+
   super::sort_by_decreasing_efficiency();
 
-  for (unsigned int i=0; i!=m_correspondence.size(); ++i)
-    m_local_index[ m_correspondence[i] ] = i;
+  reorder( m_profit, previous );
+  reorder( m_weight, previous );
 } // mono_problem::sort_by_decreasing_efficiency()
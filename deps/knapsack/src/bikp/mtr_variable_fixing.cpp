@@ -703,21 +703,19 @@ void mtr_variable_fixing::fix_variables
 void mtr_variable_fixing::fix_more()
 {
   real_type needed_capacity = 0;
+  bool conflict = false;
   fixed_set_type::const_iterator it;
 
   for (it=this->m_set_variables.begin(); it!=this->m_set_variables.end(); ++it)
     {
       needed_capacity += this->m_problem.weight( *it );  
 
-#ifndef NDEBUG
-      if (m_unset_variables.find(*it) != m_unset_variables.end() )
-        assert( m_set_variables.size() + m_unset_variables.size()
-                >= m_problem.size() );
-#endif
+      if ( m_unset_variables.find(*it) != m_unset_variables.end() )
+        conflict = true;
     }
 
-  // infeasibility ==> lower bound is optimal
-  if ( needed_capacity > this->m_problem.capacity() )
+  // infeasibility or a variable fixed to both values ==> lower bound is optimal
+  if ( conflict || (needed_capacity > this->m_problem.capacity()) )
     {
       this->m_set_variables.clear();
       
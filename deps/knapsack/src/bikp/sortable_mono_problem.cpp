@@ -27,10 +27,13 @@
  * \param size The number of variables in the problem.
  */
 sortable_mono_problem::sortable_mono_problem( const unsigned int size )
-  : m_correspondence(size), m_efficiency(size)
+  : m_correspondence(size), m_local_index(size), m_efficiency(size)
 {
   for (unsigned int i=0; i!=m_correspondence.size(); ++i)
-    m_correspondence[i] = i;
+    {
+      m_correspondence[i] = i;
+      m_local_index[i] = i;
+    }
 } // sortable_mono_problem::sortable_mono_problem()
 
 /*----------------------------------------------------------------------------*/
@@ -49,10 +52,23 @@ unsigned int sortable_mono_problem::real_index( unsigned int index ) const
  */
 void sortable_mono_problem::sort_by_decreasing_efficiency()
 {
+  // the items are sorted from the order of the parent problem, as if the
+  // problem had never been sorted
+  const std::vector<std::size_t> previous( m_local_index );
+  std::vector<real_type> efficiency( m_efficiency.size() );
+
   for (unsigned int i=0; i!=m_correspondence.size(); ++i)
-    m_correspondence[i] = i;
+    {
+      efficiency[ m_correspondence[i] ] = m_efficiency[i];
+      m_correspondence[i] = i;
+    }
 
-  efficiency_comparison comp( m_efficiency );
+  efficiency_comparison comp( efficiency );
 
   std::sort(m_correspondence.begin(), m_correspondence.end(), comp);
+
+  for (unsigned int i=0; i!=m_correspondence.size(); ++i)
+    m_local_index[ m_correspondence[i] ] = i;
+
+  reorder( m_efficiency, previous );
 } // sorting_tools::sort_by_decreasing_efficiency()
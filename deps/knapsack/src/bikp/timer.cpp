@@ -80,7 +80,7 @@ tool::timer::~timer()
 {
   if ( !m_time_references.empty() )
     {
-      std::cerr << "Some timers has not been closed (see log)." << std::cerr;
+      std::cerr << "Some timers has not been closed (see log)." << std::endl;
 
       while( !m_time_references.empty() )
 	stop();
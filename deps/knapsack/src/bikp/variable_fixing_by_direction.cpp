@@ -38,39 +38,25 @@ variable_fixing_by_direction::variable_fixing_by_direction
   bound_set_type Z_SE;
   Z_SE.insert( X_SE.begin(), X_SE.end() );
 
-  bound_set_type::const_iterator it = Z_SE.begin();
-  bound_set_type::const_iterator it2 = it;
-
-  for (++it2; it2!=Z_SE.end(); ++it, ++it2)
-    {
-      combined_problem mono_p
-	( p, it->profit_2 - it2->profit_2, it2->profit_1 - it->profit_1 );
-
-      // can be tightened
-      const real_type lb_lambda =
-	mono_p.get_lambda_1() * it->profit_1
-	+ mono_p.get_lambda_2() * it2->profit_2;
-
-      mono_p.sort_by_decreasing_efficiency();
-
-      // do the reduction on the combined objective only
-      mono_problem* one_objective = mono_p.convert_to_mono(0);
-
-      simple_variable_fixing red( *one_objective, lb_lambda );
-      delete one_objective;
-
-      for (unsigned int i=0; i!=p.size(); ++i)
-	if ( pattern[ mono_p.real_index(i) ] == '1' )
-	  {
-	    if ( red.set_variables().find(i) == red.set_variables().end() )
-	      pattern[ mono_p.real_index(i) ] = '.';
-	  }
-	else if ( pattern[ mono_p.real_index(i) ] == '0' )
-	  {
-	    if ( red.unset_variables().find(i) == red.unset_variables().end() )
-	      pattern[ mono_p.real_index(i) ] = '.';
-	  }
-    }
+  // the directions are indexed for the parallel loop
+  const std::vector<bi_profit> points( Z_SE.begin(), Z_SE.end() );
+  const long directions = (long)points.size() - 1;
+
+  // each thread removes from its own copy of the pattern the variables that
+  // its directions can not fix, then the copies are intersected
+#pragma omp parallel if (directions > 1)
+  {
+    std::string local_pattern( pattern );
+
+#pragma omp for schedule(dynamic)
+    for (long d=0; d<directions; ++d)
+      fix_in_direction( p, points[d], points[d+1], local_pattern );
+
+#pragma omp critical (bikp_variable_fixing_by_direction)
+    for (unsigned int i=0; i!=p.size(); ++i)
+      if ( local_pattern[i] == '.' )
+        pattern[i] = '.';
+  }
 
   for (unsigned int i=0; i!=p.size(); ++i)
     if ( pattern[i] == '1' )
@@ -81,6 +67,49 @@ variable_fixing_by_direction::variable_fixing_by_direction
   this->create_sub_problem();
 } // variable_fixing_by_direction::variable_fixing_by_direction()
 
+/*----------------------------------------------------------------------------*/
+/**
+ * \brief Remove from a pattern the variables that can not be fixed in the
+ *        direction given by two consecutive supported points.
+ * \param p The problem to reduce.
+ * \param z_left The point of the direction with the highest second objective.
+ * \param z_right The point of the direction with the highest first objective.
+ * \param pattern (in/out) The pattern of the fixed variables.
+ */
+void variable_fixing_by_direction::fix_in_direction
+( const bi_problem& p, const bi_profit& z_left, const bi_profit& z_right,
+  std::string& pattern ) const
+{
+  combined_problem mono_p
+    ( p, z_left.profit_2 - z_right.profit_2,
+      z_right.profit_1 - z_left.profit_1 );
+
+  // can be tightened
+  const real_type lb_lambda =
+    mono_p.get_lambda_1() * z_left.profit_1
+    + mono_p.get_lambda_2() * z_right.profit_2;
+
+  mono_p.sort_by_decreasing_efficiency();
+
+  // do the reduction on the combined objective only
+  mono_problem* one_objective = mono_p.convert_to_mono(0);
+
+  simple_variable_fixing red( *one_objective, lb_lambda );
+  delete one_objective;
+
+  for (unsigned int i=0; i!=p.size(); ++i)
+    if ( pattern[ mono_p.real_index(i) ] == '1' )
+      {
+	if ( red.set_variables().find(i) == red.set_variables().end() )
+	  pattern[ mono_p.real_index(i) ] = '.';
+      }
+    else if ( pattern[ mono_p.real_index(i) ] == '0' )
+      {
+	if ( red.unset_variables().find(i) == red.unset_variables().end() )
+	  pattern[ mono_p.real_index(i) ] = '.';
+      }
+} // variable_fixing_by_direction::fix_in_direction()
+
 /*----------------------------------------------------------------------------*/
 void variable_fixing_by_direction::make_pattern
 ( std::string& pattern, const std::list<bi_solution>& X_SE ) const
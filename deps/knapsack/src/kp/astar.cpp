@@ -15,6 +15,7 @@
 #include <bikp/solver/dynamic_programming_single.hpp>
 
 #include <climits>
+#include <omp.h>
 
 // fastest: 0 1 x
 // less nodes: 1 1 x
@@ -327,7 +328,10 @@ bool kp::astar::node::branch_one( std::size_t i )
         }
     }
   else
-    ++g_diffuse_dominance;
+    {
+#pragma omp atomic
+      ++g_diffuse_dominance;
+    }
 
   m_dead = m_dead || !result;
 
@@ -425,6 +429,7 @@ bool kp::astar::node::interesting()
                < m_data.get_cardinality_lower_bound() )
             {
               result = false;
+#pragma omp atomic
               ++g_cardinality;
             }
           else
@@ -464,6 +469,7 @@ bool kp::astar::node::hull_test() const
       bound_set_type::const_iterator it_n;
 
       result = false;
+      m_data.lock();
 
       // check that not all nadir-like points are below the hull
       for ( it_n=m_data.bound_set_begin();
@@ -478,10 +484,15 @@ bool kp::astar::node::hull_test() const
                   result && (it_c!=m_reduced_hull.end()); ++it_c )
               result = it_c->check( *it_n - m_pending_solution.image() );
           }
+
+      m_data.unlock();
     }
 
   if (!result)
-    ++g_hull;
+    {
+#pragma omp atomic
+      ++g_hull;
+    }
 
   return result;
 } // astar::node::hull_test()
@@ -500,6 +511,8 @@ bool kp::astar::node::bound_test() const
       cost_compare compare;
       bound_set_type::const_iterator it_n;
 
+      m_data.lock();
+
       for ( it_n=m_data.bound_set_begin();
             !result && (it_n!=m_data.bound_set_end()); ++it_n )
         if ( compare(m_utopian, *it_n) & moo::general_dominance )
@@ -508,11 +521,19 @@ bool kp::astar::node::bound_test() const
             result = m_utopian_upper_bound >= lower_bound;
           }
 
+      m_data.unlock();
+
       if (!result)
-        ++g_relax;
+        {
+#pragma omp atomic
+          ++g_relax;
+        }
     }
   else
-    ++g_utopian;
+    {
+#pragma omp atomic
+      ++g_utopian;
+    }
 
   return result;
 } // astar::node::bound_test()
@@ -525,43 +546,45 @@ bool kp::astar::node::bound_test() const
  */
 bool kp::astar::node::diffuse_dominance_one()
 { 
-  std::list<std::size_t> free_vars;
-  const std::size_t s = m_data.get_view().get_size();
+  typedef solution_data::word_type word_type;
 
-  // \todo Rcuprer aussi l'ensemble des variables  1
-  for (std::size_t i=0; i!=s; ++i)
-    if ( m_pending_solution.status_of( m_data.get_view().get_variable(i) )
-         == moo::bin_free )
-      free_vars.push_front(i);
+  std::vector<word_type> free_vars;
+  m_data.get_free_variables(m_pending_solution, free_vars);
 
+  const std::size_t s = m_data.get_view().get_size();
+  const std::size_t row_size = m_data.get_row_size();
   bool result = true;
 
   for (std::size_t i=0; (i!=s) && result && (m_free_variables_count!=0); ++i)
     if ( m_pending_solution.status_of( m_data.get_view().get_variable(i) )
          == moo::bin_set )
       {
-        std::list<std::size_t>::iterator it=free_vars.begin();
+        const word_type* row = m_data.get_dominating_row(i);
 
-        while ( (it!=free_vars.end()) && result )
-          if ( m_data.first_dominates_second(*it, i) )
-            {
-              if ( m_data.get_view().get_variable(*it).weight
-                   > m_remaining_capacity )
-                result = false;
-              else
-                {
-                  m_pending_solution.set( m_data.get_view().get_variable(*it) );
-                  --m_free_variables_count;
-                  m_remaining_capacity -=
-                    m_data.get_view().get_variable(*it).weight;
-
-                  std::list<std::size_t>::iterator tmp(it);
-                  ++it;
-                  free_vars.erase(tmp);
-                }
-            }
-          else
-            ++it;
+        for (std::size_t k=0; (k!=row_size) && result; ++k)
+          {
+            word_type bits = row[k] & free_vars[k];
+            free_vars[k] &= ~bits;
+
+            while ( (bits != 0) && result )
+              {
+                const std::size_t j =
+                  k * solution_data::word_bits
+                  + solution_data::lowest_bit(bits);
+                bits &= bits - 1;
+
+                if ( m_data.get_view().get_variable(j).weight
+                     > m_remaining_capacity )
+                  result = false;
+                else
+                  {
+                    m_pending_solution.set( m_data.get_view().get_variable(j) );
+                    --m_free_variables_count;
+                    m_remaining_capacity -=
+                      m_data.get_view().get_variable(j).weight;
+                  }
+              }
+          }
       }
 
   return result;
@@ -573,37 +596,40 @@ bool kp::astar::node::diffuse_dominance_one()
  */
 void kp::astar::node::diffuse_dominance_zero()
 {
-  std::list<std::size_t> free_vars;
-  const std::size_t s = m_data.get_view().get_size();
+  typedef solution_data::word_type word_type;
 
-  // todo Rcuprer aussi les variables  0
-  for (std::size_t i=0; i!=s; ++i)
-    if ( m_pending_solution.status_of( m_data.get_view().get_variable(i) )
-         == moo::bin_free )
-      free_vars.push_front(i);
+  std::vector<word_type> free_vars;
+  m_data.get_free_variables(m_pending_solution, free_vars);
+
+  const std::size_t s = m_data.get_view().get_size();
+  const std::size_t row_size = m_data.get_row_size();
 
   for (std::size_t i=0; (i!=s) && (m_free_variables_count!=0); ++i)
     if ( m_pending_solution.status_of( m_data.get_view().get_variable(i) )
          == moo::bin_unset )
       {
-        std::list<std::size_t>::iterator it=free_vars.begin();
+        const word_type* row = m_data.get_dominated_row(i);
 
-        while ( it!=free_vars.end() )
-          if ( m_data.first_dominates_second(i, *it) )
-            {
-              assert
-                ( m_pending_solution.status_of
-                  ( m_data.get_view().get_variable(*it) ) == moo::bin_free );
-
-              m_pending_solution.unset( m_data.get_view().get_variable(*it) );
-              --m_free_variables_count;
-
-              std::list<std::size_t>::iterator tmp(it);
-              ++it;
-              free_vars.erase(tmp);
-            }
-          else
-            ++it;
+        for (std::size_t k=0; k!=row_size; ++k)
+          {
+            word_type bits = row[k] & free_vars[k];
+            free_vars[k] &= ~bits;
+
+            while ( bits != 0 )
+              {
+                const std::size_t j =
+                  k * solution_data::word_bits
+                  + solution_data::lowest_bit(bits);
+                bits &= bits - 1;
+
+                assert
+                  ( m_pending_solution.status_of
+                    ( m_data.get_view().get_variable(j) ) == moo::bin_free );
+
+                m_pending_solution.unset( m_data.get_view().get_variable(j) );
+                --m_free_variables_count;
+              }
+          }
       }
 } // astar::node::diffuse_dominance_zero()
 
@@ -851,103 +877,265 @@ kp::astar::node_comparator::compare_max( std::size_t a, std::size_t b ) const
 
 /*----------------------------------------------------------------------------*/
 /**
- * \brief Solve an instance of a multi-objective knapsack problem using a branch
- *        and bound algorithm.
- * \param inst The instance to solve.
- * \param X (in) known solutions, (out) all efficient solutions.
- * \param o The order applied to the variables.
+ * \brief The exploration of the nodes, shared by the OpenMP tasks.
+ *
+ * Each task is a worker which evaluates the best pending node until the queue
+ * is empty. A worker creates a new one when it leaves more than one pending
+ * node, as long as there are fewer workers than threads. Thus the tasks do not
+ * nest deeper than the number of threads, the threads without a worker wait
+ * for the next task in the OpenMP runtime, and the search ends when all the
+ * workers are done.
  */
-void kp::astar::solve( const knapsack_instance& inst, maximum_set& X, int o )
+class kp::astar::search
 {
-  solution_data data(inst, X, o);
+public:
+  search( solution_data& data, maximum_set& X );
+
+  void run( node* root );
+
+private:
+  void work();
+  bool evaluate( node* n );
+  void log_progress();
+
 #if SORT_NODES
-  queue_type pending;
+  void update_nb_dominated_solutions();
+#endif
+
+private:
+  /** \brief Some help to solve the instance. */
+  solution_data& m_data;
+
+  /** \brief The solutions found. */
+  const maximum_set& m_solutions;
+
+  /** \brief The pending nodes, protected by the kp_astar_pending critical
+      section. */
+#if SORT_NODES
+  queue_type m_pending;
 #else
-  std::stack<node*> pending;
+  std::stack<node*> m_pending;
 #endif
 
-  std::size_t nodes_explored(0);
-  std::size_t nodes_fathomed(0);
-  std::size_t overflow(0);
-  std::size_t ref_n(0);
-  time_t ref_date( time(NULL) );
+  /** \brief The number of workers running, protected by the kp_astar_pending
+      critical section. */
+  std::size_t m_workers;
 
-  pending.push( new node(data) );
+  /** \brief The maximum number of workers. */
+  std::size_t m_max_workers;
 
-  std::cout << "starting A*" << std::endl;
+  /** \brief The number of nodes extended. */
+  std::size_t m_nodes_explored;
+
+  /** \brief The number of nodes not extended. */
+  std::size_t m_nodes_fathomed;
+
+  /** \brief How many times m_nodes_explored went back to zero. */
+  std::size_t m_overflow;
+
+  /** \brief The value of m_nodes_explored at the last log. */
+  std::size_t m_ref_n;
+
+  /** \brief The date of the last log. */
+  time_t m_ref_date;
+
+}; // class astar::search
+
+/*----------------------------------------------------------------------------*/
+/**
+ * \brief Constructor.
+ * \param data Some help to solve the instance.
+ * \param X The solutions found, kept by \a data.
+ */
+kp::astar::search::search( solution_data& data, maximum_set& X )
+  : m_data(data), m_solutions(X), m_workers(0), m_max_workers(1),
+    m_nodes_explored(0), m_nodes_fathomed(0),
+    m_overflow(0), m_ref_n(0), m_ref_date( time(NULL) )
+{
+
+} // astar::search::search()
+
+/*----------------------------------------------------------------------------*/
+/**
+ * \brief Explore the nodes in parallel, starting from a given node.
+ * \param root The first node, deleted by the search.
+ */
+void kp::astar::search::run( node* root )
+{
+  m_pending.push( root );
+  m_workers = 1;
+
+#pragma omp parallel
+#pragma omp single
+  {
+    m_max_workers = omp_get_num_threads();
+    work();
+  }
+
+  std::cout << m_nodes_explored << " nodes explored (+2^"
+            << (sizeof(std::size_t) * CHAR_BIT) << " * " << m_overflow
+            << "), " << m_nodes_fathomed << " nodes fathomed. |"
+            << " diff=" << g_diffuse_dominance
+            << " card=" << g_cardinality
+            << " utopian=" << g_utopian
+            << " relax=" << g_relax
+            << " hull=" << g_hull
+            << std::endl;
+} // astar::search::run()
+
+/*----------------------------------------------------------------------------*/
+/**
+ * \brief Evaluate the best pending node until there is none, creating a new
+ *        worker when there are enough pending nodes.
+ */
+void kp::astar::search::work()
+{
+  node* n;
 
-  while ( !pending.empty() )
+  do
     {
-      time_t now = time(NULL);
+#pragma omp critical (kp_astar_pending)
+      {
+        log_progress();
 
-      if ( now - ref_date >= 5 ) // 5 seconds interval log
+        if ( m_pending.empty() )
+          {
+            n = NULL;
+            --m_workers;
+          }
+        else
+          {
+            n = m_pending.top();
+            m_pending.pop();
+          }
+      }
+
+      // the task is created out of the critical section, an undeferred task
+      // would enter it again
+      if ( (n != NULL) && evaluate(n) )
         {
-          const std::size_t n(pending.size());
-          std::cout << n << " remaining nodes ("
-                    << ((double)(nodes_explored - ref_n)
-                        / (double)(now - ref_date))
-                    << " nodes per second, " << nodes_explored
-                    << " explored [+" << (nodes_explored - ref_n) << "]) and "
-                    << X.size() << " solutions."
-                    << std::endl;
-          ref_n = nodes_explored;
-          ref_date = now;
+#pragma omp task
+          work();
         }
+    }
+  while ( n != NULL );
+} // astar::search::work()
 
-      node* n = pending.top();
-      pending.pop();
+/*----------------------------------------------------------------------------*/
+/**
+ * \brief Evaluate a node and push its children in the pending nodes.
+ * \param n The node to evaluate, deleted by this method.
+ * \return true if the caller must create a new worker.
+ */
+bool kp::astar::search::evaluate( node* n )
+{
+  node_pair new_n( (node*)NULL, (node*)NULL );
+  const bool explored = n->bound_is_interesting();
 
-      if ( n->bound_is_interesting() )
-        {
-          ++nodes_explored;
-          if (nodes_explored == 0)
-            ++overflow;
+  if ( explored )
+    new_n = n->extends();
 
-          data.unset_modified();
-          node_pair new_n = n->extends();
+  delete n;
 
-          if ( new_n.second != NULL )
-            pending.push(new_n.second);
+  bool result = false;
 
-          if ( new_n.first != NULL )
-            pending.push(new_n.first);
+#pragma omp critical (kp_astar_pending)
+  {
+    if ( explored )
+      {
+        ++m_nodes_explored;
+        if (m_nodes_explored == 0)
+          ++m_overflow;
+
+        if ( new_n.second != NULL )
+          m_pending.push(new_n.second);
+
+        if ( new_n.first != NULL )
+          m_pending.push(new_n.first);
 
 #if SORT_NODES
-          if ( data.is_modified() )
-            update_nb_dominated_solutions( pending );
+        if ( m_data.is_modified() )
+          {
+            m_data.unset_modified();
+            update_nb_dominated_solutions();
+          }
 #endif
-        }
-      else
-        ++nodes_fathomed;
+      }
+    else
+      ++m_nodes_fathomed;
 
-      delete n;
-    }
+    if ( (m_pending.size() > 1) && (m_workers < m_max_workers) )
+      {
+        ++m_workers;
+        result = true;
+      }
+  }
 
-  std::cout << nodes_explored << " nodes explored (+2^"
-            << (sizeof(std::size_t) * CHAR_BIT) << " * " << overflow << "), "
-            << nodes_fathomed << " nodes fathomed. |"
-            << " diff=" << g_diffuse_dominance
-            << " card=" << g_cardinality
-            << " utopian=" << g_utopian
-            << " relax=" << g_relax
-            << " hull=" << g_hull
+  return result;
+} // astar::search::evaluate()
+
+/*----------------------------------------------------------------------------*/
+/**
+ * \brief Write the progress of the search, every five seconds.
+ * \pre The caller is in the kp_astar_pending critical section.
+ */
+void kp::astar::search::log_progress()
+{
+  const time_t now = time(NULL);
+
+  if ( now - m_ref_date < 5 )
+    return;
+
+  m_data.lock();
+  const std::size_t nb_sols( m_solutions.size() );
+  m_data.unlock();
+
+  std::cout << m_pending.size() << " remaining nodes ("
+            << ((double)(m_nodes_explored - m_ref_n)
+                / (double)(now - m_ref_date))
+            << " nodes per second, " << m_nodes_explored
+            << " explored [+" << (m_nodes_explored - m_ref_n)
+            << "]) and " << nb_sols << " solutions."
             << std::endl;
-} // astar::solve()
 
+  m_ref_n = m_nodes_explored;
+  m_ref_date = now;
+} // astar::search::log_progress()
+
+#if SORT_NODES
 /*----------------------------------------------------------------------------*/
 /**
- * \brief Update the number of dominated solutions in each node.
- * \param pending The pending nodes.
+ * \brief Update the number of dominated solutions in each pending node.
+ * \pre The caller is in the kp_astar_pending critical section.
  */
-void kp::astar::update_nb_dominated_solutions( queue_type& pending )
+void kp::astar::search::update_nb_dominated_solutions()
 {
   queue_type old_pending;
-  std::swap( old_pending, pending );
+  std::swap( old_pending, m_pending );
 
   for ( ; !old_pending.empty(); old_pending.pop() )
     {
       node* n = old_pending.top();
       n->update_nb_dominated_solutions();
-      pending.push(n);
+      m_pending.push(n);
     }
-} // astar::update_nb_dominated_solutions()
+} // astar::search::update_nb_dominated_solutions()
+#endif
+
+/*----------------------------------------------------------------------------*/
+/**
+ * \brief Solve an instance of a multi-objective knapsack problem using a branch
+ *        and bound algorithm.
+ * \param inst The instance to solve.
+ * \param X (in) known solutions, (out) all efficient solutions.
+ * \param o The order applied to the variables.
+ */
+void kp::astar::solve( const knapsack_instance& inst, maximum_set& X, int o )
+{
+  solution_data data(inst, X, o);
+  search s(data, X);
+
+  std::cout << "starting A*" << std::endl;
+
+  s.run( new node(data) );
+} // astar::solve()
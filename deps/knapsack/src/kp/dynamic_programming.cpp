@@ -5,6 +5,25 @@
  */
 #include "kp/dynamic_programming.hpp"
 
+#include <algorithm>
+#include <functional>
+#include <limits>
+
+/*----------------------------------------------------------------------------*/
+/**
+ * \brief Constructor.
+ * \param bound_pruning Tell if the states whose upper bound is dominated by a
+ *        known feasible point must be removed.
+ * \param epsilon The approximation ratio of the computed points. Zero for an
+ *        exact resolution. A positive ratio implies the pruning of the states.
+ */
+kp::dynamic_programming::dynamic_programming
+( bool bound_pruning, double epsilon )
+  : m_bound_pruning(bound_pruning), m_epsilon(epsilon)
+{
+
+} // dynamic_programming::dynamic_programming()
+
 /*----------------------------------------------------------------------------*/
 /**
  * \brief Compute the efficient points for a given instance.
@@ -14,108 +33,508 @@
 void kp::dynamic_programming::solve
 ( const knapsack_instance& inst, pareto_set& Z ) const
 {
-  const unsigned int capacity = (unsigned int)inst.get_capacity();
-  const unsigned int layer_size = capacity + 1;
+  std::vector<unsigned int> order;
+  state_list states;
+  bound_list lower_bounds;
+
+  run( inst, order, states, NULL, lower_bounds );
+
+  for ( std::size_t i=0; i!=states.size(); ++i )
+    Z.insert( states[i].profit );
+
+  if ( m_epsilon > 0 )
+    for ( std::size_t i=0; i!=lower_bounds.size(); ++i )
+      Z.insert( lower_bounds[i].profit );
+} // dynamic_programming::solve()
+
+/*----------------------------------------------------------------------------*/
+/**
+ * \brief Compute a minimum complete set for a given instance.
+ * \param inst The instance to solve.
+ * \param Xm The solutions computed.
+ */
+void kp::dynamic_programming::solve
+( const knapsack_instance& inst, minimum_set& Xm ) const
+{
+  std::vector<unsigned int> order;
+  state_list states;
+  trace_list traces;
+  bound_list lower_bounds;
+  std::vector<unsigned int> items;
+
+  run( inst, order, states, &traces, lower_bounds );
+
+  for ( std::size_t i=0; i!=states.size(); ++i )
+    {
+      items.clear();
+      trace_items( traces, order, i, items );
+      Xm.insert( make_solution(inst, items) );
+    }
+
+  if ( m_epsilon > 0 )
+    for ( std::size_t i=0; i!=lower_bounds.size(); ++i )
+      Xm.insert( make_solution(inst, lower_bounds[i].items) );
+} // dynamic_programming::solve()
+
+/*----------------------------------------------------------------------------*/
+/**
+ * \brief Build the non dominated states of the whole instance.
+ * \param inst The instance to solve.
+ * \param order (out) The items, in the order in which they are considered.
+ * \param states (out) The non dominated states, by increasing weight.
+ * \param traces (out) If not NULL, receives the origin of the states for each
+ *        item.
+ * \param lower_bounds (out) The non dominated feasible points found by the
+ *        pruning of the states.
+ */
+void kp::dynamic_programming::run
+( const knapsack_instance& inst, std::vector<unsigned int>& order,
+  state_list& states, trace_list* traces, bound_list& lower_bounds ) const
+{
+  state_list next;
+  state s;
+
+  sort_items(inst, order);
 
-  std::vector<pareto_set*> layer(layer_size, NULL);
-  unsigned int w;
+  s.weight = 0;
+  s.profit = cost_vector( inst.get_nb_objectives(), 0 );
+  states.assign( 1, s );
 
-  layer[0] = new pareto_set;
-  layer[0]->insert( cost_vector(inst.get_nb_objectives(), 0) );
+  lower_bounds.clear();
+
+  if ( traces != NULL )
+    traces->clear();
+
+  // with an approximation ratio, all the states may be covered by the
+  // feasible points
+  for ( unsigned int t=0; (t!=order.size()) && !states.empty(); ++t )
+    {
+      std::vector<trace>* tr = NULL;
+
+      if ( traces != NULL )
+        {
+          traces->push_back( std::vector<trace>() );
+          tr = &traces->back();
+        }
+
+      merge
+        ( states, inst.get_variable(order[t]), inst.get_capacity(), next, tr );
+      states.swap(next);
+
+      if ( m_bound_pruning || (m_epsilon > 0) )
+        prune( inst, order, t + 1, states, traces, lower_bounds );
+    }
+} // dynamic_programming::run()
+
+/*----------------------------------------------------------------------------*/
+/**
+ * \brief Compute the states obtained by adding or not an item to the current
+ *        states.
+ * \param states The current states, by increasing weight then by
+ *        lexicographically decreasing profit.
+ * \param v The item to add.
+ * \param capacity The capacity of the knapsack.
+ * \param result (out) The non dominated states, in the same order than
+ *        \a states.
+ * \param traces (out) If not NULL, receives the origin of each state of
+ *        \a result.
+ *
+ * The states of \a states do not dominate each other, neither do their
+ * translations by \a v. Thus a state needs only to be compared with the kept
+ * states coming from the other list, and all of them are lighter.
+ */
+void kp::dynamic_programming::merge
+( const state_list& states, const variable& v, moo::real_type capacity,
+  state_list& result, std::vector<trace>* traces ) const
+{
+  std::size_t nb_added = 0;
+
+  while ( (nb_added != states.size())
+          && (states[nb_added].weight + v.weight <= capacity) )
+    ++nb_added;
+
+  result.clear();
+  result.reserve( states.size() + nb_added );
+
+  if ( traces != NULL )
+    traces->reserve( states.size() + nb_added );
+
+  std::vector<std::size_t> kept[2];
+  std::size_t next[2] = { 0, 0 };
+  state added;
+
+  while ( (next[0] != states.size()) || (next[1] != nb_added) )
+    {
+      if ( next[1] != nb_added )
+        {
+          added.weight = states[next[1]].weight + v.weight;
+          added.profit = states[next[1]].profit + v.cost;
+        }
+
+      bool set;
+
+      if ( next[1] == nb_added )
+        set = false;
+      else if ( next[0] == states.size() )
+        set = true;
+      else if ( added.weight != states[next[0]].weight )
+        set = added.weight < states[next[0]].weight;
+      else
+        set = states[next[0]].profit < added.profit;
+
+      const state& s = set ? added : states[next[set]];
+      const std::vector<std::size_t>& other = kept[!set];
+      bool dominated = false;
+
+      for ( std::size_t i=other.size(); !dominated && (i!=0); )
+        {
+          --i;
+          dominated = covers( result[other[i]].profit, s.profit );
+        }
+
+      if ( !dominated )
+        {
+          kept[set].push_back( result.size() );
+          result.push_back(s);
+
+          if ( traces != NULL )
+            {
+              trace tr;
+              tr.parent = next[set];
+              tr.set = set;
+              traces->push_back(tr);
+            }
+        }
+
+      ++next[set];
+    }
+} // dynamic_programming::merge()
+
+/*----------------------------------------------------------------------------*/
+/**
+ * \brief Sort the items by decreasing efficiency on the sum of the
+ *        objectives. The items too heavy for the knapsack are left aside.
+ * \param inst The instance to solve.
+ * \param order (out) The indices of the items, in this order.
+ */
+void kp::dynamic_programming::sort_items
+( const knapsack_instance& inst, std::vector<unsigned int>& order ) const
+{
+  std::vector< std::pair<moo::real_type, unsigned int> > eff;
 
   for ( unsigned int i=0; i!=inst.get_size(); ++i )
     {
       const variable& v( inst.get_variable(i) );
 
-      std::vector<pareto_set*> new_layer(layer);
+      if ( v.weight <= inst.get_capacity() )
+        {
+          moo::real_type sum = 0;
+
+          for ( unsigned int k=0; k!=inst.get_nb_objectives(); ++k )
+            sum += v.cost[k];
+
+          if ( v.weight > 0 )
+            eff.push_back
+              ( std::make_pair(sum / v.weight, inst.get_size() - i) );
+          else
+            eff.push_back
+              ( std::make_pair( std::numeric_limits<moo::real_type>::max(),
+                                inst.get_size() - i ) );
+        }
+    }
+
+  std::sort
+    ( eff.begin(), eff.end(),
+      std::greater< std::pair<moo::real_type, unsigned int> >() );
+
+  order.resize( eff.size() );
 
-      for ( w=layer_size; w != 0; )
-	{
-	  --w;
-	  unsigned int new_w = w + (unsigned int)v.weight;
+  for ( std::size_t i=0; i!=eff.size(); ++i )
+    order[i] = inst.get_size() - eff[i].second;
+} // dynamic_programming::sort_items()
 
-	  if ( layer[w] != NULL )
-	    if ( new_w <= capacity )
-	      {
-		if ( new_layer[new_w] == NULL )
-		  new_layer[new_w] = new pareto_set;
+/*----------------------------------------------------------------------------*/
+/**
+ * \brief Remove the states that cannot lead to an efficient point.
+ * \param inst The instance to solve.
+ * \param order The items, in the order in which they are considered.
+ * \param next The position in \a order of the next item to consider.
+ * \param states (in/out) The states to check.
+ * \param traces (in/out) If not NULL, the origin of the states, the last
+ *        entry is updated as the states are removed.
+ * \param lower_bounds (in/out) The non dominated feasible points known so far.
+ *
+ * Every state is completed greedily with the remaining items, in the order of
+ * the algorithm, to get a feasible point. The best state on each objective is
+ * also completed in the order of the efficiencies on this objective. A state
+ * is removed if the upper bound of its completions is dominated by one of
+ * these points. The bound is the bound of Dantzig on each objective.
+ *
+ * With an approximation ratio, the state is removed if the bound is covered
+ * by one of these points multiplied by 1 + m_epsilon. The points may then be
+ * returned, so their items are kept when the traces are built.
+ */
+void kp::dynamic_programming::prune
+( const knapsack_instance& inst, const std::vector<unsigned int>& order,
+  unsigned int next, state_list& states, trace_list* traces,
+  bound_list& lower_bounds ) const
+{
+  const bool keep_items = (m_epsilon > 0) && (traces != NULL);
+  const unsigned int p = inst.get_nb_objectives();
+  const moo::real_type capacity = inst.get_capacity();
+  cost_vector free_profit(p, 0);
+  std::vector< std::vector<moo::real_type> > prefix_weight(p);
+  std::vector< std::vector<moo::real_type> > prefix_profit(p);
+  std::vector< std::vector<moo::real_type> > efficiency(p);
+
+  for ( unsigned int k=0; k!=p; ++k )
+    {
+      std::vector< std::pair<moo::real_type, unsigned int> > eff;
+      std::size_t best = 0;
+
+      for ( unsigned int t=next; t!=order.size(); ++t )
+        {
+          const variable& v( inst.get_variable(order[t]) );
+
+          if ( v.weight > 0 )
+            eff.push_back( std::make_pair( v.cost[k] / v.weight, t ) );
+          else
+            free_profit[k] += v.cost[k];
+        }
 
-		pareto_set::const_iterator it;
+      std::sort
+        ( eff.begin(), eff.end(),
+          std::greater< std::pair<moo::real_type, unsigned int> >() );
 
-		for ( it=layer[w]->begin(); it!=layer[w]->end(); ++it )
-		  new_layer[new_w]->insert( *it + v.cost );
-	      }
-	}
+      prefix_weight[k].resize( eff.size() + 1, 0 );
+      prefix_profit[k].resize( eff.size() + 1, 0 );
+      efficiency[k].resize( eff.size() );
 
-      std::swap(layer, new_layer);
+      for ( std::size_t i=0; i!=eff.size(); ++i )
+        {
+          const variable& v( inst.get_variable(order[eff[i].second]) );
+
+          prefix_weight[k][i+1] = prefix_weight[k][i] + v.weight;
+          prefix_profit[k][i+1] = prefix_profit[k][i] + v.cost[k];
+          efficiency[k][i] = eff[i].first;
+        }
+
+      for ( std::size_t i=1; i!=states.size(); ++i )
+        if ( states[best].profit[k] < states[i].profit[k] )
+          best = i;
+
+      cost_vector lb( states[best].profit + free_profit );
+      moo::real_type w = states[best].weight;
+      std::vector<unsigned int> items;
+
+      for ( std::size_t i=0; i!=eff.size(); ++i )
+        {
+          const variable& v( inst.get_variable(order[eff[i].second]) );
+
+          if ( w + v.weight <= capacity )
+            {
+              w += v.weight;
+              lb += v.cost;
+              items.push_back( order[eff[i].second] );
+            }
+        }
+
+      if ( add_lower_bound( lower_bounds, lb ) && keep_items )
+        {
+          std::vector<unsigned int>& lb_items = lower_bounds.back().items;
+
+          trace_items( *traces, order, best, lb_items );
+          lb_items.insert( lb_items.end(), items.begin(), items.end() );
+
+          for ( unsigned int t=next; t!=order.size(); ++t )
+            if ( inst.get_variable(order[t]).weight <= 0 )
+              lb_items.push_back( order[t] );
+        }
     }
 
-  for ( w=0; w!=layer_size; ++w )
-    if ( layer[w] != NULL )
-      {
-	Z.insert( layer[w]->begin(), layer[w]->end() );
-	delete layer[w];
-      }
-} // dynamic_programming::solve()
+  for ( std::size_t i=0; i!=states.size(); ++i )
+    {
+      cost_vector lb( states[i].profit );
+      moo::real_type w = states[i].weight;
+      std::vector<unsigned int> items;
+
+      for ( unsigned int t=next; t!=order.size(); ++t )
+        {
+          const variable& v( inst.get_variable(order[t]) );
+
+          if ( w + v.weight <= capacity )
+            {
+              w += v.weight;
+              lb += v.cost;
+              items.push_back( order[t] );
+            }
+        }
+
+      if ( add_lower_bound( lower_bounds, lb ) && keep_items )
+        {
+          std::vector<unsigned int>& lb_items = lower_bounds.back().items;
+
+          trace_items( *traces, order, i, lb_items );
+          lb_items.insert( lb_items.end(), items.begin(), items.end() );
+        }
+    }
+
+  std::size_t n = 0;
+  cost_vector ub(p);
+
+  for ( std::size_t i=0; i!=states.size(); ++i )
+    {
+      const moo::real_type residual = capacity - states[i].weight;
+
+      for ( unsigned int k=0; k!=p; ++k )
+        {
+          // the bound of Dantzig: the items are taken by decreasing
+          // efficiency, the first one that does not fit is taken partially
+          const std::size_t j =
+            std::upper_bound
+            ( prefix_weight[k].begin(), prefix_weight[k].end(), residual )
+            - prefix_weight[k].begin() - 1;
+
+          ub[k] = states[i].profit[k] + free_profit[k] + prefix_profit[k][j];
+
+          if ( j != efficiency[k].size() )
+            ub[k] += (residual - prefix_weight[k][j]) * efficiency[k][j];
+        }
+
+      bool dominated = false;
+
+      for ( std::size_t j=0; !dominated && (j!=lower_bounds.size()); ++j )
+        if ( m_epsilon > 0 )
+          dominated = covers( lower_bounds[j].profit, ub, 1 + m_epsilon );
+        else
+          dominated = covers( lower_bounds[j].profit, ub )
+            && (lower_bounds[j].profit != ub);
+
+      if ( !dominated )
+        {
+          states[n] = states[i];
+
+          if ( traces != NULL )
+            traces->back()[n] = traces->back()[i];
+
+          ++n;
+        }
+    }
+
+  states.resize(n);
+
+  if ( traces != NULL )
+    traces->back().resize(n);
+} // dynamic_programming::prune()
 
 /*----------------------------------------------------------------------------*/
 /**
- * \brief Compute a minimum complete set for a given instance.
- * \param inst The instance to solve.
- * \param Xm The solutions computed.
+ * \brief Get the items put in the knapsack to build a state of the last item.
+ * \param traces The origin of the states for each item.
+ * \param order The items, in the order in which they are considered.
+ * \param s The index of the state in the states of the last item.
+ * \param items (out) The items are appended to this vector.
  */
-void kp::dynamic_programming::solve
-( const knapsack_instance& inst, minimum_set& Xm ) const
+void kp::dynamic_programming::trace_items
+( const trace_list& traces, const std::vector<unsigned int>& order,
+  std::size_t s, std::vector<unsigned int>& items )
 {
-  const unsigned int capacity = (unsigned int)inst.get_capacity();
-  const unsigned int layer_size = capacity + 1;
+  for ( std::size_t t=traces.size(); t!=0; )
+    {
+      --t;
+      const trace& tr( traces[t][s] );
 
-  std::vector<minimum_set*> layer(layer_size, NULL);
-  unsigned int w;
+      if ( tr.set )
+        items.push_back( order[t] );
 
-  layer[0] = new minimum_set;
+      s = tr.parent;
+    }
+} // dynamic_programming::trace_items()
 
+/*----------------------------------------------------------------------------*/
+/**
+ * \brief Build the solution in which exactly some given items are set.
+ * \param inst The instance of the solution.
+ * \param items The items in the knapsack.
+ */
+kp::knapsack_solution kp::dynamic_programming::make_solution
+( const knapsack_instance& inst, const std::vector<unsigned int>& items )
+{
   knapsack_solution sol(inst);
-  for (unsigned int i=0; i!=inst.get_size(); ++i)
-    sol.unset( inst.get_variable(i) );
 
-  layer[0]->insert( sol );
+  for ( unsigned int j=0; j!=inst.get_size(); ++j )
+    sol.unset( inst.get_variable(j) );
 
-  for ( unsigned int i=0; i!=inst.get_size(); ++i )
-    {
-      const unsigned int v_weight( (unsigned int)inst.get_variable(i).weight );
+  for ( std::size_t i=0; i!=items.size(); ++i )
+    sol.set( inst.get_variable(items[i]) );
 
-      std::vector<minimum_set*> new_layer(layer);
+  return sol;
+} // dynamic_programming::make_solution()
 
-      for ( w=layer_size; w != 0; )
-	{
-	  --w;
-	  const unsigned int new_w = w + v_weight;
+/*----------------------------------------------------------------------------*/
+/**
+ * \brief Add a feasible point in a set of non dominated points.
+ * \param lower_bounds (in/out) The set of points.
+ * \param lb The point to add.
+ * \return true if the point has been added, at the end of \a lower_bounds,
+ *         without items.
+ */
+bool kp::dynamic_programming::add_lower_bound
+( bound_list& lower_bounds, const cost_vector& lb )
+{
+  bool dominated = false;
 
-	  if ( layer[w] != NULL )
-	    if ( new_w <= capacity )
-	      {
-		if ( new_layer[new_w] == NULL )
-		  new_layer[new_w] = new minimum_set;
+  for ( std::size_t i=0; !dominated && (i!=lower_bounds.size()); ++i )
+    dominated = covers( lower_bounds[i].profit, lb );
 
-		minimum_set::const_iterator it;
+  if ( !dominated )
+    {
+      std::size_t n = 0;
 
-		for ( it=layer[w]->begin(); it!=layer[w]->end(); ++it )
-		  {
-		    sol = *it;
-		    sol.set( inst.get_variable(i) );
-		    new_layer[new_w]->insert( sol );
-		  }
-	      }
-	}
+      for ( std::size_t i=0; i!=lower_bounds.size(); ++i )
+        if ( !covers( lb, lower_bounds[i].profit ) )
+          lower_bounds[n++] = lower_bounds[i];
 
-      std::swap(layer, new_layer);
+      lower_bounds.resize(n + 1);
+      lower_bounds[n].profit = lb;
+      lower_bounds[n].items.clear();
     }
 
-  for ( w=0; w!=layer_size; ++w )
-    if ( layer[w] != NULL )
-      {
-	Xm.insert( layer[w]->begin(), layer[w]->end() );
-	delete layer[w];
-      }
-} // dynamic_programming::solve()
+  return !dominated;
+} // dynamic_programming::add_lower_bound()
+
+/*----------------------------------------------------------------------------*/
+/**
+ * \brief Tell if a profit vector is greater or equal to another one on all
+ *        the objectives.
+ * \param a The vector that may cover the other one.
+ * \param b The vector that may be covered.
+ */
+bool kp::dynamic_programming::covers( const cost_vector& a, const cost_vector& b )
+{
+  bool result = true;
+
+  for ( unsigned int k=0; result && (k!=a.size()); ++k )
+    result = a[k] >= b[k];
+
+  return result;
+} // dynamic_programming::covers()
+
+/*----------------------------------------------------------------------------*/
+/**
+ * \brief Tell if a profit vector, multiplied by a given ratio, is greater or
+ *        equal to another one on all the objectives.
+ * \param a The vector that may cover the other one.
+ * \param b The vector that may be covered.
+ * \param ratio The factor applied to \a a.
+ */
+bool kp::dynamic_programming::covers
+( const cost_vector& a, const cost_vector& b, double ratio )
+{
+  bool result = true;
+
+  for ( unsigned int k=0; result && (k!=a.size()); ++k )
+    result = (double)a[k] * ratio >= (double)b[k];
+
+  return result;
+} // dynamic_programming::covers()
@@ -11,6 +11,8 @@
 #include <kp/view_weighted_sum.hpp>
 #include <kp/phase_1.hpp>
 
+#include <omp.h>
+
 /*----------------------------------------------------------------------------*/
 /**
  * \brief Constructor.
@@ -20,9 +22,7 @@
  */
 kp::mobb::bb_procedure::bb_procedure
 ( const knapsack_instance& instance, maximum_set& X, int o )
-  : m_instance(instance), m_kp(m_instance),
-    m_bound_set( cost_vector(m_kp.get_nb_objectives(), 0) ),
-    m_solutions(X)
+  : m_instance(instance), m_data(instance, X, o), m_task_depth(0)
 {
   total_nodes =
     closed_diffuse_dominance_one_counter =
@@ -30,52 +30,13 @@ kp::mobb::bb_procedure::bb_procedure
     closed_utopian_counter =
     closed_relaxation_counter = 0;
 
-  cardinality_lower_bound<> card;
-  m_kp_card_lb = card.compute(instance);
-
-  switch(o)
-    {
-    case order_on_items::order_topological:
-      m_kp.topological_efficiency();
-      break;
-    case order_on_items::order_max_rank: m_kp.max_rank(); break;
-    case order_on_items::order_min_rank: m_kp.min_rank(); break;
-    case order_on_items::order_sum_rank: m_kp.sum_rank(); break;
-    case order_on_items::order_frequency: m_kp.frequency(m_solutions); break;
-    case order_on_items::order_random: m_kp.random(); break;
-    case order_on_items::order_domination_rank: m_kp.domination_rank(); break;
-    case order_on_items::order_domination_count: m_kp.domination_count(); break;
-    default: m_kp.decreasing_efficiency(o);
-    }
-
-  maximum_set::const_iterator it;
-
-  for (it=X.begin(); it!=X.end(); ++it)
-    m_bound_set.reduce( it->image() );
-
-  const unsigned int n = m_instance.get_size();
-
-  m_dominates.resize(n);
-  std::fill( m_dominates.begin(), m_dominates.end(),
-             std::vector<bool>(n, false) );
+  // enough tasks to keep the threads busy when some subtrees are fathomed
+  // early
+  for ( int t = omp_get_max_threads(); t > 1; t /= 2 )
+    ++m_task_depth;
 
-  for (unsigned int i=0; i!=n; ++i)
-    for (unsigned int j=i+1; j!=n; ++j)
-      {
-        m_dominates[i][j] = dominates(i, j);
-        m_dominates[j][i] = dominates(j, i);
-      }
-
-  /*std::ofstream f("ordered.coord");
-  for (unsigned int i=0; i!=n; ++i)
-    {
-      f << m_kp.get_variable(i).index;
-
-      for (unsigned int j=0; j!=m_kp.get_nb_objectives(); ++j)
-        f << ' ' << m_kp.get_variable(i).cost[j];
-
-      f << ' ' << m_kp.get_variable(i).weight << '\n';
-    }*/
+  if ( m_task_depth != 0 )
+    m_task_depth += 6;
 } // mobb::bb_procedure::bb_procedure()
 
 /*----------------------------------------------------------------------------*/
@@ -89,57 +50,53 @@ void kp::mobb::bb_procedure::run()
 {
   knapsack_solution sol(m_instance);
 
-  bb( m_kp.get_capacity(), sol, m_kp.get_size() );
+#pragma omp parallel if (m_task_depth != 0)
+#pragma omp single
+  bb( m_data.get_view().get_capacity(), sol, m_data.get_view().get_size(), 0 );
 } // mobb::bb_procedure::run()
 
-/*----------------------------------------------------------------------------*/
-/**
- * \brief Tell if a variables \a i dominates a variables \a j.
- * \param i The index of the first variable.
- * \param j The index of the second variable.
- */
-bool kp::mobb::bb_procedure::dominates( unsigned int i, unsigned int j ) const
-{
-  cost_compare compare;
-  bool result = false;
-
-  const variable& vi( m_kp.get_variable(i) );
-  const variable& vj( m_kp.get_variable(j) );
-
-  if ( compare( vi.cost, vj.cost ) & moo::general_dominance )
-    result = vi.weight <= vj.weight;
-  else if ( vi.cost == vj.cost )
-    result = vi.weight < vj.weight;;
-
-  return result;
-} // mobb::bb_procedure::dominates()
-
 /*----------------------------------------------------------------------------*/
 /**
  * \brief Apply the branch and bound to the current instance.
  * \param w The remaining capacity.
  * \param sol The solution that we are building.
  * \param n The number of free variables.
+ * \param depth The depth of the node in the tree.
  */
 void kp::mobb::bb_procedure::bb
-( moo::real_type w, knapsack_solution& sol, unsigned int n )
+( moo::real_type w, knapsack_solution& sol, unsigned int n,
+  unsigned int depth )
 {
-  assert( m_kp.get_capacity() - sol.value().weight == w );
+  assert( m_data.get_view().get_capacity() - sol.value().weight == w );
 
+#pragma omp atomic
   ++total_nodes;
 
   if ( n==0 )
     {
       assert( m_instance.check(sol) );
-      m_solutions.insert(sol);
-      m_bound_set.reduce(sol.image());
+      m_data.insert(sol);
     }
   else
     {
       unsigned int i = next_index(sol);
 
-      branch_one(w, sol, i, n);
-      branch_zero(w, sol, i, n);
+      if ( depth < m_task_depth )
+        {
+          // the task works on its own copy, sol is modified by branch_zero()
+          // meanwhile
+          knapsack_solution sol_one(sol);
+
+#pragma omp task firstprivate(sol_one)
+          branch_one(w, sol_one, i, n, depth + 1);
+
+          branch_zero(w, sol, i, n, depth + 1);
+        }
+      else
+        {
+          branch_one(w, sol, i, n, depth + 1);
+          branch_zero(w, sol, i, n, depth + 1);
+        }
     }
 } // mobb::bb_procedure::bb()
 
@@ -153,7 +110,7 @@ kp::mobb::bb_procedure::next_index( const knapsack_solution& sol ) const
 {
   unsigned int i = 0;
 
-  while ( sol.status_of( m_kp.get_variable(i) ) != moo::bin_free )
+  while ( sol.status_of( m_data.get_view().get_variable(i) ) != moo::bin_free )
     ++i;
 
   return i;
@@ -166,22 +123,24 @@ kp::mobb::bb_procedure::next_index( const knapsack_solution& sol ) const
  * \param sol The solution that we are building.
  * \param i The index of the variable to set.
  * \param n The number of free variables.
+ * \param depth The depth of the node in the tree.
  */
 void kp::mobb::bb_procedure::branch_one
-( moo::real_type w, knapsack_solution& sol, unsigned int i, unsigned int n )
+( moo::real_type w, knapsack_solution& sol, unsigned int i, unsigned int n,
+  unsigned int depth )
 {
-  assert( i < m_kp.get_size() );
-  assert( m_kp.get_capacity() - sol.value().weight == w );
-  assert( m_kp.get_variable(i).weight <= w );
+  assert( i < m_data.get_view().get_size() );
+  assert( m_data.get_view().get_capacity() - sol.value().weight == w );
+  assert( m_data.get_view().get_variable(i).weight <= w );
   assert( n > 0);
-  assert( sol.status_of( m_kp.get_variable(i) ) == moo::bin_free );
+  assert( sol.status_of( m_data.get_view().get_variable(i) ) == moo::bin_free );
   
   std::list<unsigned int> set_to_zero;
   std::list<unsigned int> set_to_one;
 
-  sol.set( m_kp.get_variable(i) );
+  sol.set( m_data.get_view().get_variable(i) );
   --n;
-  w -= m_kp.get_variable(i).weight;
+  w -= m_data.get_view().get_variable(i).weight;
 
   if ( diffuse_dominance_one(w, sol, n, set_to_one) )
     {
@@ -189,20 +148,23 @@ void kp::mobb::bb_procedure::branch_one
       diffuse_dominance_zero(sol, n, set_to_zero);
 
       if ( interesting(w, sol, n) )
-        bb(w, sol, n);
+        bb(w, sol, n, depth);
     }
   else
-    ++closed_diffuse_dominance_one_counter;
+    {
+#pragma omp atomic
+      ++closed_diffuse_dominance_one_counter;
+    }
 
-  sol.free( m_kp.get_variable(i) );
+  sol.free( m_data.get_view().get_variable(i) );
 
   std::list<unsigned int>::const_iterator it;
 
   for (it=set_to_zero.begin(); it!=set_to_zero.end(); ++it)
-    sol.free( m_kp.get_variable(*it) );
+    sol.free( m_data.get_view().get_variable(*it) );
 
   for (it=set_to_one.begin(); it!=set_to_one.end(); ++it)
-    sol.free( m_kp.get_variable(*it) );
+    sol.free( m_data.get_view().get_variable(*it) );
 } // mobb::bb_procedure::branch_one()
 
 /*----------------------------------------------------------------------------*/
@@ -212,31 +174,33 @@ void kp::mobb::bb_procedure::branch_one
  * \param sol The solution that we are building.
  * \param i The index of the variable to set.
  * \param n The number of free variables.
+ * \param depth The depth of the node in the tree.
  */
 void kp::mobb::bb_procedure::branch_zero
-( moo::real_type w, knapsack_solution& sol, unsigned int i, unsigned int n )
+( moo::real_type w, knapsack_solution& sol, unsigned int i, unsigned int n,
+  unsigned int depth )
 {
-  assert( i < m_kp.get_size() );
+  assert( i < m_data.get_view().get_size() );
   assert( n > 0 );
-  assert( sol.status_of( m_kp.get_variable(i) ) == moo::bin_free );
-  assert( m_kp.get_capacity() - sol.value().weight == w );
+  assert( sol.status_of( m_data.get_view().get_variable(i) ) == moo::bin_free );
+  assert( m_data.get_view().get_capacity() - sol.value().weight == w );
 
   std::list<unsigned int> set_to_zero;
 
-  sol.unset( m_kp.get_variable(i) );
+  sol.unset( m_data.get_view().get_variable(i) );
   --n;
 
   diffuse_dominance_zero(sol, n, set_to_zero );
 
   if ( interesting(w, sol, n) )
-    bb(w, sol, n);
+    bb(w, sol, n, depth);
 
-  sol.free( m_kp.get_variable(i) );
+  sol.free( m_data.get_view().get_variable(i) );
 
   std::list<unsigned int>::const_iterator it;
 
   for (it=set_to_zero.begin(); it!=set_to_zero.end(); ++it)
-    sol.free( m_kp.get_variable(*it) );
+    sol.free( m_data.get_view().get_variable(*it) );
 } // mobb::bb_procedure::branch_zero()
 
 /*----------------------------------------------------------------------------*/
@@ -251,13 +215,13 @@ unsigned int kp::mobb::bb_procedure::unset_big_items
   std::list<unsigned int>& set_to_zero ) const
 {
   unsigned int result = 0;
-  const unsigned int s = m_kp.get_size();
+  const unsigned int s = m_data.get_view().get_size();
 
   for (unsigned int i=0; i!=s; ++i)
-    if ( sol.status_of( m_kp.get_variable(i) ) == moo::bin_free )
-      if ( m_kp.get_variable(i).weight > w )
+    if ( sol.status_of( m_data.get_view().get_variable(i) ) == moo::bin_free )
+      if ( m_data.get_view().get_variable(i).weight > w )
         {
-          sol.unset( m_kp.get_variable(i) );
+          sol.unset( m_data.get_view().get_variable(i) );
           set_to_zero.push_front(i);
           ++result;
         }
@@ -279,15 +243,15 @@ bool kp::mobb::bb_procedure::interesting
   bool result = true;
 
   if ( n==0 )
-    result = !m_solutions.is_dominated(sol);
+    result = !m_data.is_dominated(sol);
   else 
     {
       std::vector<std::size_t> free_vars(n);
       unsigned int j=0;
-      const unsigned int s = m_kp.get_size();
+      const unsigned int s = m_data.get_view().get_size();
 
       for (unsigned int i=0; i!=s; ++i)
-        if ( sol.status_of( m_kp.get_variable(i) ) == moo::bin_free )
+        if ( sol.status_of( m_data.get_view().get_variable(i) ) == moo::bin_free )
           {
             free_vars[j] = i;
             ++j;
@@ -295,14 +259,18 @@ bool kp::mobb::bb_procedure::interesting
 
       bool do_rl = false;
 
-      if ( sol.solution().cardinality() < m_kp_card_lb )
+      if ( sol.solution().cardinality()
+           < m_data.get_cardinality_lower_bound() )
         {
           cardinality_upper_bound< view_order<> > card_ub;
-          const std::size_t card_ub_val = card_ub.compute(m_kp, free_vars, w);
+          const std::size_t card_ub_val =
+            card_ub.compute(m_data.get_view(), free_vars, w);
           
-          if ( sol.solution().cardinality() + card_ub_val < m_kp_card_lb )
+          if ( sol.solution().cardinality() + card_ub_val
+               < m_data.get_cardinality_lower_bound() )
             {
               result = false;
+#pragma omp atomic
               ++closed_cardinality_counter;
             }
           else
@@ -316,7 +284,7 @@ bool kp::mobb::bb_procedure::interesting
           linear_relaxation< view_order<> > rl;
 
           const cost_vector utopian =
-            sol.value().cost + rl.compute(m_kp, free_vars, w);
+            sol.value().cost + rl.compute(m_data.get_view(), free_vars, w);
 
           result = bound_test( w, sol, free_vars, utopian );
 
@@ -353,7 +321,7 @@ bool kp::mobb::bb_procedure::hull_test
   typedef subset_view< view_order<> > sub_problem_type;
   typedef phase_1<sub_problem_type> phase_1_type;
 
-  sub_problem_type sub_p(m_kp, free_vars, w);
+  sub_problem_type sub_p(m_data.get_view(), free_vars, w);
   phase_1_type phase(sub_p);
 
   phase.run();
@@ -369,9 +337,11 @@ bool kp::mobb::bb_procedure::hull_test
 
   bound_set_type::const_iterator it_n;
 
+  m_data.lock();
+
   // check if all nadir-like points are above the hull
-  for ( it_n=m_bound_set.begin();
-        !result && (it_n!=m_bound_set.end()); ++it_n )
+  for ( it_n=m_data.bound_set_begin();
+        !result && (it_n!=m_data.bound_set_end()); ++it_n )
     {
       std::set<phase_1_type::constraint_type>::const_iterator it_c;
       result = true; // suppose that this nadir satisfies all constraints
@@ -382,6 +352,8 @@ bool kp::mobb::bb_procedure::hull_test
         result = it_c->check( *it_n - sol.image() );
     }
 
+  m_data.unlock();
+
   return result || (phase.get_XSEm().size() == 0);
 } // mobb::bb_procedure::hull_test()
 
@@ -400,11 +372,11 @@ bool kp::mobb::bb_procedure::bound_test
 {
   bool result = false;
 
-  if ( !m_solutions.is_dominated(utopian) )
+  if ( !m_data.is_dominated(utopian) )
     {
       cost_compare compare;
 
-      view_weighted_sum< view_order<> > mono(m_kp, utopian);
+      view_weighted_sum< view_order<> > mono(m_data.get_view(), utopian);
       linear_relaxation< view_weighted_sum< view_order<> > > rl;
 
       const moo::real_type upper_bound =
@@ -413,19 +385,29 @@ bool kp::mobb::bb_procedure::bound_test
 
       bound_set_type::const_iterator it_n;
 
-      for ( it_n=m_bound_set.begin();
-            !result && (it_n!=m_bound_set.end()); ++it_n )
+      m_data.lock();
+
+      for ( it_n=m_data.bound_set_begin();
+            !result && (it_n!=m_data.bound_set_end()); ++it_n )
         if ( compare(utopian, *it_n) & moo::general_dominance )
           {
             const moo::real_type lower_bound = it_n->scalar_product(utopian);
             result = upper_bound >= lower_bound;
           }
 
+      m_data.unlock();
+
       if ( result == false )
-        ++closed_relaxation_counter;
+        {
+#pragma omp atomic
+          ++closed_relaxation_counter;
+        }
     }
   else
-    ++closed_utopian_counter;
+    {
+#pragma omp atomic
+      ++closed_utopian_counter;
+    }
 
   return result;
 } // mobb::bb_procedure::bound_test()
@@ -444,40 +426,43 @@ bool kp::mobb::bb_procedure::diffuse_dominance_one
 ( moo::real_type& w, knapsack_solution& sol, unsigned int& n,
   std::list<unsigned int>& set_to_one ) const
 { 
+  typedef solution_data::word_type word_type;
 
-  std::list<unsigned int> free_vars;
-  const unsigned int s = m_kp.get_size();
-
-  for (unsigned int i=0; i!=s; ++i)
-    if ( sol.status_of( m_kp.get_variable(i) ) == moo::bin_free )
-      free_vars.push_front(i);
+  std::vector<word_type> free_vars;
+  m_data.get_free_variables(sol, free_vars);
 
+  const unsigned int s = m_data.get_view().get_size();
+  const std::size_t row_size = m_data.get_row_size();
   bool result = true;
 
   for (unsigned int i=0; (i!=s) && result && (n!=0); ++i)
-    if ( sol.status_of( m_kp.get_variable(i) ) == moo::bin_set )
+    if ( sol.status_of( m_data.get_view().get_variable(i) ) == moo::bin_set )
       {
-        std::list<unsigned int>::iterator it=free_vars.begin();
+        const word_type* row = m_data.get_dominating_row(i);
 
-        while ( (it!=free_vars.end()) && result )
-          if ( m_dominates[*it][i] )
-            {
-              if ( m_kp.get_variable(*it).weight > w )
-                result = false;
-              else
-                {
-                  sol.set( m_kp.get_variable(*it) );
-                  set_to_one.push_front(*it);
-                  --n;
-                  w -= m_kp.get_variable(*it).weight;
-
-                  std::list<unsigned int>::iterator tmp(it);
-                  ++it;
-                  free_vars.erase(tmp);
-                }
-            }
-          else
-            ++it;
+        for (std::size_t k=0; (k!=row_size) && result; ++k)
+          {
+            word_type bits = row[k] & free_vars[k];
+            free_vars[k] &= ~bits;
+
+            while ( (bits != 0) && result )
+              {
+                const unsigned int j =
+                  k * solution_data::word_bits
+                  + solution_data::lowest_bit(bits);
+                bits &= bits - 1;
+
+                if ( m_data.get_view().get_variable(j).weight > w )
+                  result = false;
+                else
+                  {
+                    sol.set( m_data.get_view().get_variable(j) );
+                    set_to_one.push_front(j);
+                    --n;
+                    w -= m_data.get_view().get_variable(j).weight;
+                  }
+              }
+          }
       }
 
   return result;
@@ -495,32 +480,38 @@ void kp::mobb::bb_procedure::diffuse_dominance_zero
 ( knapsack_solution& sol, unsigned int& n,
   std::list<unsigned int>& set_to_zero ) const
 {
-  std::list<unsigned int> free_vars;
-  const unsigned int s = m_kp.get_size();
+  typedef solution_data::word_type word_type;
 
-  for (unsigned int i=0; i!=s; ++i)
-    if ( sol.status_of( m_kp.get_variable(i) ) == moo::bin_free )
-      free_vars.push_front(i);
+  std::vector<word_type> free_vars;
+  m_data.get_free_variables(sol, free_vars);
+
+  const unsigned int s = m_data.get_view().get_size();
+  const std::size_t row_size = m_data.get_row_size();
 
   for (unsigned int i=0; (i!=s) && (n!=0); ++i)
-    if ( sol.status_of( m_kp.get_variable(i) ) == moo::bin_unset )
+    if ( sol.status_of( m_data.get_view().get_variable(i) ) == moo::bin_unset )
       {
-        std::list<unsigned int>::iterator it=free_vars.begin();
+        const word_type* row = m_data.get_dominated_row(i);
 
-        while ( it!=free_vars.end() )
-          if ( m_dominates[i][*it] )
-            {
-              assert( sol.status_of(m_kp.get_variable(*it)) == moo::bin_free );
-              sol.unset( m_kp.get_variable(*it) );
-              set_to_zero.push_front(*it);
-              --n;
-
-              std::list<unsigned int>::iterator tmp(it);
-              ++it;
-              free_vars.erase(tmp);
-            }
-          else
-            ++it;
+        for (std::size_t k=0; k!=row_size; ++k)
+          {
+            word_type bits = row[k] & free_vars[k];
+            free_vars[k] &= ~bits;
+
+            while ( bits != 0 )
+              {
+                const unsigned int j =
+                  k * solution_data::word_bits
+                  + solution_data::lowest_bit(bits);
+                bits &= bits - 1;
+
+                assert( sol.status_of(m_data.get_view().get_variable(j))
+                        == moo::bin_free );
+                sol.unset( m_data.get_view().get_variable(j) );
+                set_to_zero.push_front(j);
+                --n;
+              }
+          }
       }
 } // mobb::bb_procedure::diffuse_dominance_zero()
 
@@ -8,6 +8,8 @@
 #include <kp/cardinality_lower_bound.hpp>
 #include <kp/order_on_items.hpp>
 
+#include <cassert>
+
 /*----------------------------------------------------------------------------*/
 /**
  * \brief Constructor.
@@ -21,6 +23,8 @@ kp::solution_data::solution_data
     m_bound_set( cost_vector(m_kp.get_nb_objectives(), 0) ), m_solutions(X),
     m_modified(false)
 {
+  omp_init_nest_lock( &m_lock );
+
   cardinality_lower_bound<> card;
   m_kp_card_lb = card.compute(instance);
 
@@ -44,20 +48,18 @@ kp::solution_data::solution_data
   for (it=X.begin(); it!=X.end(); ++it)
     m_bound_set.reduce( it->image() );
 
-  const unsigned int n = instance.get_size();
-
-  m_dominates.resize(n);
-  std::fill( m_dominates.begin(), m_dominates.end(),
-             std::vector<bool>(n, false) );
-
-  for (unsigned int i=0; i!=n; ++i)
-    for (unsigned int j=i+1; j!=n; ++j)
-      {
-        m_dominates[i][j] = dominates(i, j);
-        m_dominates[j][i] = dominates(j, i);
-      }
+  build_dominance_matrices();
 } // solution_data::solution_data()
 
+/*----------------------------------------------------------------------------*/
+/**
+ * \brief Destructor.
+ */
+kp::solution_data::~solution_data()
+{
+  omp_destroy_nest_lock( &m_lock );
+} // solution_data::~solution_data()
+
 /*----------------------------------------------------------------------------*/
 /**
  * \brief Get the initial instance.
@@ -71,7 +73,7 @@ const kp::knapsack_instance& kp::solution_data::get_instance() const
 /**
  * \brief Get the view on the instance.
  */
-const kp::view_order<> kp::solution_data::get_view() const
+const kp::view_order<>& kp::solution_data::get_view() const
 {
   return m_kp;
 } // solution_data::get_view()
@@ -92,6 +94,8 @@ std::size_t kp::solution_data::get_cardinality_lower_bound() const
  */
 void kp::solution_data::insert( const knapsack_solution& sol )
 {
+  lock();
+
   int r = m_solutions.insert(sol);
 
   if ( r!=0 ) // the solution was added
@@ -99,6 +103,8 @@ void kp::solution_data::insert( const knapsack_solution& sol )
       m_modified = true;
       m_bound_set.reduce(sol.image());
     }
+
+  unlock();
 } // solution_data::insert()
 
 /*----------------------------------------------------------------------------*/
@@ -108,7 +114,11 @@ void kp::solution_data::insert( const knapsack_solution& sol )
  */
 bool kp::solution_data::is_dominated( const knapsack_solution& sol ) const
 {
-  return m_solutions.is_dominated(sol);
+  lock();
+  const bool result = m_solutions.is_dominated(sol);
+  unlock();
+
+  return result;
 } // solution_data::is_dominated()
 
 /*----------------------------------------------------------------------------*/
@@ -118,7 +128,11 @@ bool kp::solution_data::is_dominated( const knapsack_solution& sol ) const
  */
 bool kp::solution_data::is_dominated( const cost_vector& y ) const
 {
-  return m_solutions.is_dominated(y);
+  lock();
+  const bool result = m_solutions.is_dominated(y);
+  unlock();
+
+  return result;
 } // solution_data::is_dominated()
 
 /*----------------------------------------------------------------------------*/
@@ -131,9 +145,71 @@ bool kp::solution_data::is_dominated( const cost_vector& y ) const
 bool
 kp::solution_data::first_dominates_second( std::size_t i, std::size_t j ) const
 {
-  return m_dominates[i][j];
+  return (m_dominated[i * m_row_size + j / word_bits] >> (j % word_bits)) & 1;
 } // solution_data::first_dominates_second()
 
+/*----------------------------------------------------------------------------*/
+/**
+ * \brief Get the number of words in a row of the dominance matrices.
+ */
+std::size_t kp::solution_data::get_row_size() const
+{
+  return m_row_size;
+} // solution_data::get_row_size()
+
+/*----------------------------------------------------------------------------*/
+/**
+ * \brief Get the items dominated by an item, as a row of get_row_size() words.
+ * \param i The index of the item in the view.
+ */
+const kp::solution_data::word_type*
+kp::solution_data::get_dominated_row( std::size_t i ) const
+{
+  return &m_dominated[i * m_row_size];
+} // solution_data::get_dominated_row()
+
+/*----------------------------------------------------------------------------*/
+/**
+ * \brief Get the items dominating an item, as a row of get_row_size() words.
+ * \param j The index of the item in the view.
+ */
+const kp::solution_data::word_type*
+kp::solution_data::get_dominating_row( std::size_t j ) const
+{
+  return &m_dominating[j * m_row_size];
+} // solution_data::get_dominating_row()
+
+/*----------------------------------------------------------------------------*/
+/**
+ * \brief Get the mask of the free variables of a solution, indexed as the
+ *        view.
+ * \param sol The solution.
+ * \param free_vars (out) The mask, of get_row_size() words.
+ */
+void kp::solution_data::get_free_variables
+( const knapsack_solution& sol, std::vector<word_type>& free_vars ) const
+{
+  const std::size_t s = m_kp.get_size();
+
+  free_vars.assign( m_row_size, 0 );
+
+  for (std::size_t i=0; i!=s; ++i)
+    if ( sol.status_of( m_kp.get_variable(i) ) == moo::bin_free )
+      free_vars[i / word_bits] |= word_type(1) << (i % word_bits);
+} // solution_data::get_free_variables()
+
+/*----------------------------------------------------------------------------*/
+/**
+ * \brief Get the index of the lowest bit set in a word.
+ * \param w The word, not zero.
+ */
+std::size_t kp::solution_data::lowest_bit( word_type w )
+{
+  assert( w != 0 );
+
+  return __builtin_ctzl(w);
+} // solution_data::lowest_bit()
+
 /*----------------------------------------------------------------------------*/
 /**
  * \brief Get an iterator on the beginning of the bound set.
@@ -161,7 +237,11 @@ kp::solution_data::bound_set_end() const
  */
 bool kp::solution_data::is_modified() const
 {
-  return m_modified;
+  lock();
+  const bool result = m_modified;
+  unlock();
+
+  return result;
 } // solution_data::is_modified()
 
 /*----------------------------------------------------------------------------*/
@@ -170,9 +250,30 @@ bool kp::solution_data::is_modified() const
  */
 void kp::solution_data::unset_modified()
 {
+  lock();
   m_modified = false;
+  unlock();
 } // solution_data::unset_modified()
 
+/*----------------------------------------------------------------------------*/
+/**
+ * \brief Get the exclusive access to the solutions and to the bound set. The
+ *        calls to lock() and unlock() must be balanced.
+ */
+void kp::solution_data::lock() const
+{
+  omp_set_nest_lock( &m_lock );
+} // solution_data::lock()
+
+/*----------------------------------------------------------------------------*/
+/**
+ * \brief Release the access got with lock().
+ */
+void kp::solution_data::unlock() const
+{
+  omp_unset_nest_lock( &m_lock );
+} // solution_data::unlock()
+
 /*----------------------------------------------------------------------------*/
 /**
  * \brief Tell if a variables \a i dominates a variables \a j.
@@ -194,3 +295,37 @@ bool kp::solution_data::dominates( std::size_t i, std::size_t j ) const
 
   return result;
 } // solution_data::dominates()
+
+/*----------------------------------------------------------------------------*/
+/**
+ * \brief Fill m_dominated and m_dominating.
+ */
+void kp::solution_data::build_dominance_matrices()
+{
+  const long n = m_kp.get_size();
+
+  m_row_size = (n + word_bits - 1) / word_bits;
+  m_dominated.assign( n * m_row_size, 0 );
+  m_dominating.assign( n * m_row_size, 0 );
+
+  // each thread fills its own rows, so the words are not shared
+#pragma omp parallel for schedule(dynamic, 16) if (n >= 256)
+  for (long i=0; i<n; ++i)
+    {
+      word_type* row = &m_dominated[i * m_row_size];
+
+      for (long j=0; j!=n; ++j)
+        if ( (i != j) && dominates(i, j) )
+          row[j / word_bits] |= word_type(1) << (j % word_bits);
+    }
+
+#pragma omp parallel for schedule(dynamic, 16) if (n >= 256)
+  for (long j=0; j<n; ++j)
+    {
+      word_type* row = &m_dominating[j * m_row_size];
+
+      for (long i=0; i!=n; ++i)
+        if ( first_dominates_second(i, j) )
+          row[i / word_bits] |= word_type(1) << (i % word_bits);
+    }
+} // solution_data::build_dominance_matrices()
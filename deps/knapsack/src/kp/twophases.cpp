@@ -2,7 +2,9 @@
 #include <kp/phase_2.hpp>
 #include <kp/twophases.hpp>
 
+#include <algorithm>
 #include <fstream>
+#include <set>
 #include <sstream>
 
 /*----------------------------------------------------------------------------*/
@@ -67,3 +69,95 @@ void twophases(int nb_obj, int sz, float *obj, float *weigths ,float capacity )
   for (unsigned int i=0; i!=XNSEM.size(); ++i)
     not_supported << XNSEM[i] << '\n';
 }
+
+/*----------------------------------------------------------------------------*/
+/**
+ * \brief Compute the efficient solutions of a multi-objective knapsack
+ *        problem, without writing anything.
+ * \param nb_obj The number of objectives.
+ * \param sz The number of items.
+ * \param obj The profits, obj[k*sz + i] is the profit of the item i on the
+ *        objective k.
+ * \param weigths The weights of the items.
+ * \param capacity The capacity of the knapsack.
+ * \param z (out) The images of the solutions, z[s*nb_obj + k] is the value of
+ *        the solution s on the objective k.
+ * \param solW (out) The weights of the solutions.
+ * \param res (out) The solutions, res[s*sz + i] tells if the item i is in the
+ *        solution s.
+ * \param nbSupported (out) The number of supported solutions. They come first
+ *        in the outputs, followed by the non supported ones.
+ * \param nbSol (out) The number of solutions.
+ */
+void twophases_front
+( int nb_obj, int sz, float *obj, float *weigths ,float capacity ,int * &z,
+  int * &solW, bool * &res, int &nbSupported, int &nbSol )
+{
+  twophases_front_approx
+    ( nb_obj, sz, obj, weigths, capacity, 0, z, solW, res, nbSupported, nbSol );
+} // twophases_front()
+
+/*----------------------------------------------------------------------------*/
+/**
+ * \brief Same as twophases_front(), but the non supported solutions are a
+ *        (1+epsilon)-approximation: for each efficient solution z, there is a
+ *        returned solution s such that z <= (1+epsilon) * s on all the
+ *        objectives.
+ */
+void twophases_front_approx
+( int nb_obj, int sz, float *obj, float *weigths ,float capacity,
+  double epsilon, int * &z, int * &solW, bool * &res, int &nbSupported,
+  int &nbSol )
+{
+  kp::knapsack_instance inst( nb_obj, sz, obj, weigths, capacity );
+  kp::phase_1<> phase_1(inst);
+
+  phase_1.run();
+
+  std::vector<kp::knapsack_solution> X
+    ( phase_1.get_XSEM().begin(), phase_1.get_XSEM().end() );
+  std::sort( X.begin(), X.end() );
+  nbSupported = X.size();
+
+  if ( X.size() >= 2 )
+    {
+      kp::phase_2<> phase_2( inst, phase_1.get_XSEM(), phase_1.get_hull() );
+      phase_2.set_approximation(epsilon);
+      phase_2.run();
+
+      // the solutions of phase 2 having the image of a supported solution are
+      // already in X
+      std::set<kp::cost_vector> supported;
+      for (unsigned int i=0; i!=X.size(); ++i)
+        supported.insert( X[i].image() );
+
+      std::vector<kp::knapsack_solution> XNSE;
+      kp::maximum_set::const_iterator it;
+
+      for ( it=phase_2.get_XNSEM().begin(); it!=phase_2.get_XNSEM().end();
+            ++it )
+        if ( supported.find(it->image()) == supported.end() )
+          XNSE.push_back(*it);
+
+      std::sort( XNSE.begin(), XNSE.end() );
+      X.insert( X.end(), XNSE.begin(), XNSE.end() );
+    }
+
+  nbSol = X.size();
+
+  z = new int[nbSol * nb_obj];
+  solW = new int[nbSol];
+  res = new bool[nbSol * sz];
+
+  for (int s=0; s!=nbSol; ++s)
+    {
+      for (int k=0; k!=nb_obj; ++k)
+        z[s * nb_obj + k] = (int)(double)X[s].image()[k];
+
+      solW[s] = (int)(double)X[s].value().weight;
+
+      for (int i=0; i!=sz; ++i)
+        res[s * sz + i] =
+          X[s].status_of( inst.get_variable(i) ) == moo::bin_set;
+    }
+} // twophases_front_approx()
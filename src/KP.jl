@@ -23,10 +23,10 @@ type KPsolver
     solve#::Function(id::KP) -> ...
 end
 
-function solveKP(id::KP, solver::KPsolver = KP_Jorge2010())
-    z1,z2,solW,res = solver.solve(id)
-    printKP(z1,z2,solW,res)
-    return z1,z2,solW,res
+function solveKP(id::KP, solver::KPsolver = isempty(id.z3) ? KP_Jorge2010() : KP_Jorge2010_3obj())
+    sols = solver.solve(id)
+    printKP(sols...)
+    return sols
 end
 
 function printKP(z1,z2,solW,res)
@@ -40,6 +40,28 @@ function printKP(z1,z2,solW,res)
     end
 end
 
+# the unexplored triangles of the anytime solver, with the bounds on λ1*z1 + λ2*z2
+function printKP(z1,z2,solW,res,gaps::Matrix{Float64})
+    printKP(z1,z2,solW,res)
+    if size(gaps,1) > 0
+        println("\nunexplored triangles\tλ1*z1+λ2*z2")
+        for i = 1:size(gaps,1)
+            println("(", Int(gaps[i,1]), ",", Int(gaps[i,2]), ") to (", Int(gaps[i,3]), ",", Int(gaps[i,4]), ")\t[", gaps[i,5], ", ", gaps[i,6], "]")
+        end
+    end
+end
+
+function printKP(z1,z2,z3,solW,res,nbSupported)
+    println("\nz1\tz2\tz3\t∑wi\tsolution")
+    for i = 1:length(z1)
+        print("(", z1[i], ",\t", z2[i], ",\t", z3[i], ")\t",solW[i], " :\t")
+        for j = 1 : size(res,2)
+            print(res[i,j] == 1 ? "1" : "0")
+        end
+        println(i <= nbSupported ? "\tsupported" : "")
+    end
+end
+
 function KP_Jorge2010()::KPsolver
     mylibvar = joinpath(LIBPATH,"libKP.so")
 
@@ -67,3 +89,184 @@ function KP_Jorge2010()::KPsolver
 
     return KPsolver(nothing, f)
 end
+
+# the second phase stops after timeLimit seconds, the efficient solutions not found are in the
+# rows of gaps : (z1,z2) of the top-left and bottom-right corners of a triangle, then the bounds
+# on λ1*z1 + λ2*z2 of its missing points, with λ1 = z2 top-left - z2 bottom-right and
+# λ2 = z1 bottom-right - z1 top-left
+function KP_Jorge2010_anytime(timeLimit::Real)::KPsolver
+    mylibvar = joinpath(LIBPATH,"libKP.so")
+
+    f = (id::KP) -> begin
+        nsize = length(id.z1)
+        p_z1,p_z2,p_solW,p_res,p_nbSol = Ref{Ptr{Cint}}(), Ref{Ptr{Cint}}(), Ref{Ptr{Cint}}(), Ref{Ptr{UInt8}}(), Ref{Cint}()
+        p_gaps,p_nbGaps = Ref{Ptr{Cdouble}}(), Ref{Cint}()
+        @eval ccall(
+            (:bi2phases_anytime, $mylibvar),
+            Void,
+            (Cint, Cint, Ref{Cint}, Ref{Cint}, Ref{Cint}, Cint, Cdouble, Ref{Ptr{Cint}}, Ref{Ptr{Cint}}, Ref{Ptr{Cint}}, Ref{Ptr{UInt8}}, Ref{Cint}, Ref{Ptr{Cdouble}}, Ref{Cint}),
+            2, $nsize, $(convert(Vector{Cint},id.z1)), $(convert(Vector{Cint},id.z2)), $(convert(Vector{Cint},id.weigths)), $(id.capacity), $(Cdouble(timeLimit)), $p_z1, $p_z2, $p_solW, $p_res, $p_nbSol, $p_gaps, $p_nbGaps)
+
+        nbSol = p_nbSol.x
+        nbGaps = p_nbGaps.x
+
+        z1 = convert(Vector{Int}, unsafe_wrap(Array, p_z1.x, nbSol, true))
+        z2 = convert(Vector{Int}, unsafe_wrap(Array, p_z2.x, nbSol, true))
+        solW = convert(Vector{Int}, unsafe_wrap(Array, p_solW.x, nbSol, true))
+        res = permutedims(reshape(convert(Vector{Bool}, unsafe_wrap(Vector{UInt8}, p_res.x, nbSol*nsize, true)), (nsize, nbSol)), (2,1))
+        gaps = permutedims(reshape(unsafe_wrap(Array, p_gaps.x, 6*nbGaps, true), (6, nbGaps)), (2,1))
+
+        return z1,z2,solW,res,gaps
+    end
+
+    return KPsolver(timeLimit, f)
+end
+
+# ε-approximation of the nondominated points : each of them is covered by a returned point
+# multiplied by 1 + epsilon, epsilon = 0 gives the exact front
+function KP_Jorge2010_approx(epsilon::Real)::KPsolver
+    mylibvar = joinpath(LIBPATH,"libKP.so")
+
+    f = (id::KP) -> begin
+        nsize = length(id.z1)
+        p_z1,p_z2,p_solW,p_res,p_nbSol = Ref{Ptr{Cint}}(), Ref{Ptr{Cint}}(), Ref{Ptr{Cint}}(), Ref{Ptr{UInt8}}(), Ref{Cint}()
+        @eval ccall(
+            (:bi2phases_approx, $mylibvar),
+            Void,
+            (Cint, Cint, Ref{Cint}, Ref{Cint}, Ref{Cint}, Cint, Cdouble, Ref{Ptr{Cint}}, Ref{Ptr{Cint}}, Ref{Ptr{Cint}}, Ref{Ptr{UInt8}}, Ref{Cint}),
+            2, $nsize, $(convert(Vector{Cint},id.z1)), $(convert(Vector{Cint},id.z2)), $(convert(Vector{Cint},id.weigths)), $(id.capacity), $(Cdouble(epsilon)), $p_z1, $p_z2, $p_solW, $p_res, $p_nbSol)
+
+        nbSol = p_nbSol.x
+
+        z1 = convert(Vector{Int}, unsafe_wrap(Array, p_z1.x, nbSol, true))
+        z2 = convert(Vector{Int}, unsafe_wrap(Array, p_z2.x, nbSol, true))
+        solW = convert(Vector{Int}, unsafe_wrap(Array, p_solW.x, nbSol, true))
+        res = permutedims(reshape(convert(Vector{Bool}, unsafe_wrap(Vector{UInt8}, p_res.x, nbSol*nsize, true)), (nsize, nbSol)), (2,1))
+
+        return z1,z2,solW,res
+    end
+
+    return KPsolver(epsilon, f)
+end
+
+# a problem solved again after small changes, the solutions of the previous resolution are
+# used to solve the next one ; the items are numbered from 1 and the next ones are shifted when
+# an item is removed
+type KPsession
+    handle::Ptr{Void}
+    size::Int
+end
+
+function KPsession(id::KP)
+    mylibvar = joinpath(LIBPATH,"libKP.so")
+    nsize = length(id.z1)
+    handle = @eval ccall(
+        (:bi2phases_session_create, $mylibvar),
+        Ptr{Void},
+        (Cint, Ref{Cint}, Ref{Cint}, Ref{Cint}, Cint),
+        $nsize, $(convert(Vector{Cint},id.z1)), $(convert(Vector{Cint},id.z2)), $(convert(Vector{Cint},id.weigths)), $(id.capacity))
+
+    s = KPsession(handle, nsize)
+    finalizer(s, s -> begin
+        @eval ccall((:bi2phases_session_destroy, $mylibvar), Void, (Ptr{Void},), $(s.handle))
+    end)
+    return s
+end
+
+function setCapacity!(s::KPsession, capacity::Int)
+    mylibvar = joinpath(LIBPATH,"libKP.so")
+    @eval ccall((:bi2phases_session_set_capacity, $mylibvar), Void, (Ptr{Void}, Cint), $(s.handle), $capacity)
+end
+
+function setItem!(s::KPsession, i::Int, z1::Int, z2::Int, weigth::Int)
+    assert(1 <= i <= s.size)
+    mylibvar = joinpath(LIBPATH,"libKP.so")
+    @eval ccall((:bi2phases_session_set_item, $mylibvar), Void, (Ptr{Void}, Cint, Cint, Cint, Cint), $(s.handle), $(i-1), $z1, $z2, $weigth)
+end
+
+function addItem!(s::KPsession, z1::Int, z2::Int, weigth::Int)
+    mylibvar = joinpath(LIBPATH,"libKP.so")
+    @eval ccall((:bi2phases_session_add_item, $mylibvar), Void, (Ptr{Void}, Cint, Cint, Cint), $(s.handle), $z1, $z2, $weigth)
+    s.size += 1
+end
+
+function removeItem!(s::KPsession, i::Int)
+    assert(1 <= i <= s.size)
+    mylibvar = joinpath(LIBPATH,"libKP.so")
+    @eval ccall((:bi2phases_session_remove_item, $mylibvar), Void, (Ptr{Void}, Cint), $(s.handle), $(i-1))
+    s.size -= 1
+end
+
+function solveKP(s::KPsession)
+    mylibvar = joinpath(LIBPATH,"libKP.so")
+    nsize = s.size
+    p_z1,p_z2,p_solW,p_res,p_nbSol = Ref{Ptr{Cint}}(), Ref{Ptr{Cint}}(), Ref{Ptr{Cint}}(), Ref{Ptr{UInt8}}(), Ref{Cint}()
+    @eval ccall(
+        (:bi2phases_session_solve, $mylibvar),
+        Void,
+        (Ptr{Void}, Ref{Ptr{Cint}}, Ref{Ptr{Cint}}, Ref{Ptr{Cint}}, Ref{Ptr{UInt8}}, Ref{Cint}),
+        $(s.handle), $p_z1, $p_z2, $p_solW, $p_res, $p_nbSol)
+
+    nbSol = p_nbSol.x
+
+    z1 = convert(Vector{Int}, unsafe_wrap(Array, p_z1.x, nbSol, true))
+    z2 = convert(Vector{Int}, unsafe_wrap(Array, p_z2.x, nbSol, true))
+    solW = convert(Vector{Int}, unsafe_wrap(Array, p_solW.x, nbSol, true))
+    res = permutedims(reshape(convert(Vector{Bool}, unsafe_wrap(Vector{UInt8}, p_res.x, nbSol*nsize, true)), (nsize, nbSol)), (2,1))
+
+    printKP(z1,z2,solW,res)
+    return z1,z2,solW,res
+end
+
+# three objectives : the supported solutions come first, nbSupported is their number
+function KP_Jorge2010_3obj()::KPsolver
+    mylibvar = joinpath(LIBPATH,"libKP.so")
+
+    f = (id::KP) -> begin
+        nsize = length(id.z1)
+        obj = convert(Vector{Cfloat}, vcat(id.z1, id.z2, id.z3))
+        p_z,p_solW,p_res,p_nbSupported,p_nbSol = Ref{Ptr{Cint}}(), Ref{Ptr{Cint}}(), Ref{Ptr{UInt8}}(), Ref{Cint}(), Ref{Cint}()
+        @eval ccall(
+            (:twophases_front, $mylibvar),
+            Void,
+            (Cint, Cint, Ref{Cfloat}, Ref{Cfloat}, Cfloat, Ref{Ptr{Cint}}, Ref{Ptr{Cint}}, Ref{Ptr{UInt8}}, Ref{Cint}, Ref{Cint}),
+            3, $nsize, $obj, $(convert(Vector{Cfloat},id.weigths)), $(Cfloat(id.capacity)), $p_z, $p_solW, $p_res, $p_nbSupported, $p_nbSol)
+
+        nbSol = p_nbSol.x
+
+        z = reshape(convert(Vector{Int}, unsafe_wrap(Array, p_z.x, 3*nbSol, true)), (3, nbSol))
+        solW = convert(Vector{Int}, unsafe_wrap(Array, p_solW.x, nbSol, true))
+        res = permutedims(reshape(convert(Vector{Bool}, unsafe_wrap(Vector{UInt8}, p_res.x, nbSol*nsize, true)), (nsize, nbSol)), (2,1))
+
+        return z[1,:],z[2,:],z[3,:],solW,res,Int(p_nbSupported.x)
+    end
+
+    return KPsolver(nothing, f)
+end
+
+# ε-approximation of the non supported points with three objectives, the supported solutions are
+# all computed
+function KP_Jorge2010_3obj_approx(epsilon::Real)::KPsolver
+    mylibvar = joinpath(LIBPATH,"libKP.so")
+
+    f = (id::KP) -> begin
+        nsize = length(id.z1)
+        obj = convert(Vector{Cfloat}, vcat(id.z1, id.z2, id.z3))
+        p_z,p_solW,p_res,p_nbSupported,p_nbSol = Ref{Ptr{Cint}}(), Ref{Ptr{Cint}}(), Ref{Ptr{UInt8}}(), Ref{Cint}(), Ref{Cint}()
+        @eval ccall(
+            (:twophases_front_approx, $mylibvar),
+            Void,
+            (Cint, Cint, Ref{Cfloat}, Ref{Cfloat}, Cfloat, Cdouble, Ref{Ptr{Cint}}, Ref{Ptr{Cint}}, Ref{Ptr{UInt8}}, Ref{Cint}, Ref{Cint}),
+            3, $nsize, $obj, $(convert(Vector{Cfloat},id.weigths)), $(Cfloat(id.capacity)), $(Cdouble(epsilon)), $p_z, $p_solW, $p_res, $p_nbSupported, $p_nbSol)
+
+        nbSol = p_nbSol.x
+
+        z = reshape(convert(Vector{Int}, unsafe_wrap(Array, p_z.x, 3*nbSol, true)), (3, nbSol))
+        solW = convert(Vector{Int}, unsafe_wrap(Array, p_solW.x, nbSol, true))
+        res = permutedims(reshape(convert(Vector{Bool}, unsafe_wrap(Vector{UInt8}, p_res.x, nbSol*nsize, true)), (nsize, nbSol)), (2,1))
+
+        return z[1,:],z[2,:],z[3,:],solW,res,Int(p_nbSupported.x)
+    end
+
+    return KPsolver(epsilon, f)
+end
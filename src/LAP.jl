@@ -41,4 +41,84 @@ function LAP_Przybylski2008()::LAPsolver
     end
 
     return LAPsolver(nothing, f)
-end
\ No newline at end of file
+end
+
+# Resout une serie d'instances de meme taille en un seul appel (en parallele cote C).
+# Les fronts sont ranges a la suite : ceux de l'instance k sont aux lignes debuts[k]:debuts[k+1]-1.
+function solveLAPbatch(ids::Vector{LAP})
+    mylibvar = joinpath(LIBPATH,"libLAP.so")
+
+    if isempty(ids)
+        return Int[], Int[], zeros(Int, 0, 0), [1]
+    end
+    nSize = ids[1].nSize
+    if any(id -> id.nSize != nSize, ids)
+        error("dimensions incorrectes")
+    end
+    nb = length(ids)
+    C1 = vcat([id.C1 for id in ids]...)
+    C2 = vcat([id.C2 for id in ids]...)
+
+    p_z1,p_z2,p_solutions,p_debuts = Ref{Ptr{Cint}}() , Ref{Ptr{Cint}}(), Ref{Ptr{Cint}}(), Ref{Ptr{Cint}}()
+    @eval ccall(
+        (:solve_bilap_batch, $mylibvar),
+        Void,
+        (Ref{Cint},Ref{Cint}, Cint, Cint, Ref{Ptr{Cint}}, Ref{Ptr{Cint}}, Ref{Ptr{Cint}}, Ref{Ptr{Cint}}),
+        $C1, $C2, $nSize, $nb, $p_z1, $p_z2, $p_solutions, $p_debuts)
+    debuts = convert(Array{Int,1},unsafe_wrap(Array, p_debuts.x, nb + 1, true)) + 1
+    nbSol = debuts[end] - 1
+    z1,z2 = convert(Array{Int,1},unsafe_wrap(Array, p_z1.x, nbSol, true)), convert(Array{Int,1},unsafe_wrap(Array, p_z2.x, nbSol, true))
+    solutions = convert(Array{Int,2},reshape(unsafe_wrap(Array, p_solutions.x, nbSol*nSize, true), (nSize, nbSol)))
+    return z1, z2, solutions', debuts
+end
+
+
+# Instance creuse : seules les affectations admissibles (i,j) sont donnees, avec leurs deux couts.
+# Les arcs sont ranges par ligne (format CSR) : ceux de la ligne i sont debut[i]+1:debut[i+1].
+type LAPsparse
+    nSize::Cint
+    debut::Array{Cint, 1}
+    colonne::Array{Cint, 1}
+    C1::Array{Cint, 1}
+    C2::Array{Cint, 1}
+end
+
+LAPsparse(n::Int, lignes::Vector{Int}, colonnes::Vector{Int}, c1::Vector{Int}, c2::Vector{Int}) = begin
+    if !(length(lignes) == length(colonnes) == length(c1) == length(c2))
+        error("dimensions incorrectes")
+    end
+    if !(all(x -> 1 <= x <= n, lignes) && all(x -> 1 <= x <= n, colonnes))
+        error("dimensions incorrectes")
+    end
+    if length(unique(zip(lignes, colonnes))) != length(lignes)
+        error("arcs en double")
+    end
+    p = sortperm(lignes)
+    debut = zeros(Cint, n + 1)
+    for i in lignes
+        debut[i + 1] += 1
+    end
+    debut = convert(Vector{Cint}, cumsum(debut))
+    LAPsparse(convert(Cint, n), debut, convert(Vector{Cint}, colonnes[p] - 1), convert(Vector{Cint}, c1[p]), convert(Vector{Cint}, c2[p]))
+end
+
+function solveLAP(id::LAPsparse)
+    mylibvar = joinpath(LIBPATH,"libLAP.so")
+
+    p_z1,p_z2,p_solutions,p_nbsolutions = Ref{Ptr{Cint}}() , Ref{Ptr{Cint}}(), Ref{Ptr{Cint}}(), Ref{Cint}()
+    @eval ccall(
+        (:solve_bilap_sparse, $mylibvar),
+        Void,
+        (Cint, Ref{Cint}, Ref{Cint}, Ref{Cint}, Ref{Cint}, Ref{Ptr{Cint}}, Ref{Ptr{Cint}}, Ref{Ptr{Cint}}, Ref{Cint}),
+        $id.nSize, $id.debut, $id.colonne, $id.C1, $id.C2, $p_z1, $p_z2, $p_solutions, $p_nbsolutions)
+    nbSol = p_nbsolutions.x
+    z1,z2 = convert(Array{Int,1},unsafe_wrap(Array, p_z1.x, nbSol, true)), convert(Array{Int,1},unsafe_wrap(Array, p_z2.x, nbSol, true))
+    colonnes = convert(Array{Int,2},reshape(unsafe_wrap(Array, p_solutions.x, nbSol*id.nSize, true), (id.nSize, nbSol)))
+    # C donne la colonne de chaque ligne ; comme pour les instances denses, solutions[k, j] est la
+    # ligne (a partir de 0) affectee a la colonne j
+    solutions = zeros(Int, nbSol, id.nSize)
+    for k = 1:nbSol, i = 1:id.nSize
+        solutions[k, colonnes[i, k] + 1] = i - 1
+    end
+    return z1, z2, solutions
+end
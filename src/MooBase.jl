@@ -1,6 +1,6 @@
 module MooBase
 
-export LAP, solveLAP, LAP_Przybylski2008, KP, solveKP, KP_Jorge2010
+export LAP, LAPsparse, solveLAP, solveLAPbatch, LAP_Przybylski2008, KP, solveKP, KP_Jorge2010, KP_Jorge2010_anytime, KP_Jorge2010_approx, KP_Jorge2010_3obj, KP_Jorge2010_3obj_approx, KPsession, setCapacity!, setItem!, addItem!, removeItem!
 
 const LIBPATH = joinpath(dirname(@__FILE__),"..","deps")
 
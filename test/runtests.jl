@@ -29,6 +29,20 @@ z1,z2,solutions = solveLAP(id)
 @test z1 == [18,19,28,35,43,54,66,22,26,34,51]
 @test solutions == [2 1 0 4 3 9 6 8 7 5; 2 1 0 4 9 5 6 8 7 3; 2 1 0 4 9 5 6 7 8 3; 2 5 0 4 9 1 6 7 8 3; 2 5 9 4 3 1 6 7 8 0; 2 5 0 3 9 1 6 7 8 4; 6 5 0 3 9 1 8 7 4 2; 2 8 0 4 9 1 6 5 7 3; 2 5 0 4 9 1 6 8 7 3; 2 1 9 4 3 0 6 7 8 5; 2 8 0 3 9 1 6 7 4 5]
 
+z1b,z2b,solutionsb,debuts = solveLAPbatch([id, LAP(10, C2, C1), id])
+@test debuts[2] - debuts[1] == length(z1) == debuts[4] - debuts[3]
+@test z1b[debuts[1]:debuts[2]-1] == z1 == z1b[debuts[3]:debuts[4]-1]
+@test solutionsb[debuts[3]:debuts[4]-1, :] == solutions
+@test sort(z1b[debuts[2]:debuts[3]-1]) == sort(z2)
+z1b,z2b,solutionsb,debuts = solveLAPbatch(LAP[])
+@test isempty(z1b) && isempty(solutionsb) && debuts == [1]
+
+lignes = vec([i for i = 1:10, j = 1:10])
+colonnes = vec([j for i = 1:10, j = 1:10])
+z1s,z2s,solutionss = solveLAP(LAPsparse(10, lignes, colonnes, vec(C1), vec(C2)))
+@test sortrows(hcat(z1s,z2s,solutionss)) == sortrows(hcat(z1,z2,solutions))
+@test_throws ErrorException LAPsparse(10, [lignes; 1], [colonnes; 1], [vec(C1); 0], [vec(C2); 0])
+
 
 c1 = [77,94,71,63,96,82,85,75,72,91,99,63,84,87,79,94,90,60,69,62,60,74,62,76,82,88,100,96,83,89]
 c2 = [65,90,90,77,95,84,70,94,66,92,74,97,60,60,65,97,93,60,69,74,85,66,100,68,92,84,63,79,72,95]
@@ -39,4 +53,43 @@ id = KP(c1,c2,weigths,capacity)
 z1,z2,sol_weigths,res = solveKP(id)
 
 @test z1 == [1300,1306,1309,1316,1317,1319,1320,1329,1330,1333,1338,1341,1342,1345,1351,1353,1354,1359]
-@test sol_weigths == [1188,1187,1186,1183,1185,1186,1188,1186,1188,1187,1188,1187,1185,1188,1187,1188,1186,1188]
\ No newline at end of file
+@test sol_weigths == [1188,1187,1186,1183,1185,1186,1188,1186,1188,1187,1188,1187,1185,1188,1187,1188,1186,1188]
+
+z1a,z2a,sol_weigthsa,resa,gaps = solveKP(id, KP_Jorge2010_anytime(60))
+@test z1a == z1 && size(gaps,1) == 0
+z1a,z2a,sol_weigthsa,resa,gaps = solveKP(id, KP_Jorge2010_anytime(0))
+@test z1a == resa * c1 && z2a == resa * c2 && all(sol_weigthsa .<= capacity)
+@test all(i -> (z1[i],z2[i]) in zip(z1a,z2a) || any(g -> g[1] < z1[i] < g[3] && g[4] < z2[i] < g[2] &&
+        g[5] <= (g[2]-g[4])*z1[i] + (g[3]-g[1])*z2[i] <= g[6], [gaps[j,:] for j = 1:size(gaps,1)]), 1:length(z1))
+z1a,z2a,sol_weigthsa,resa = solveKP(id, KP_Jorge2010_approx(0))
+@test z1a == z1 && z2a == z2
+z1a,z2a,sol_weigthsa,resa = solveKP(id, KP_Jorge2010_approx(0.01))
+@test z1a == resa * c1 && z2a == resa * c2 && all(sol_weigthsa .<= capacity)
+@test all(i -> any(j -> z1[i] <= 1.01*z1a[j] && z2[i] <= 1.01*z2a[j], 1:length(z1a)), 1:length(z1))
+session = KPsession(id)
+z1a,z2a,sol_weigthsa,resa = solveKP(session)
+@test z1a == z1 && z2a == z2
+removeItem!(session, 5)
+setCapacity!(session, capacity - 20)
+z1a,z2a,sol_weigthsa,resa = solveKP(session)
+z1b,z2b,sol_weigthsb,resb = solveKP(KP(c1[[1:4;6:30]],c2[[1:4;6:30]],weigths[[1:4;6:30]],capacity - 20))
+@test z1a == z1b && z2a == z2b && sol_weigthsa == sol_weigthsb
+addItem!(session, 90, 95, 60)
+z1a,z2a,sol_weigthsa,resa = solveKP(session)
+z1b,z2b,sol_weigthsb,resb = solveKP(KP([c1[[1:4;6:30]];90],[c2[[1:4;6:30]];95],[weigths[[1:4;6:30]];60],capacity - 20))
+@test z1a == z1b && z2a == z2b && z1a == resa * [c1[[1:4;6:30]];90]
+foreach(i -> removeItem!(session, 1), 1:30)
+z1a,z2a,sol_weigthsa,resa = solveKP(session)
+@test z1a == [0] && z2a == [0] && sol_weigthsa == [0]
+c3 = [70,60,75,85,66,91,64,80,93,77,62,81,88,99,61,72,84,90,68,73,79,95,86,65,74,83,98,71,67,89]
+z1,z2,z3,sol_weigths,res,nbSupported = solveKP(KP(c1,c2,c3,weigths,capacity))
+
+@test length(z1) == 178 && nbSupported == 30
+@test z1 == res * c1 && z2 == res * c2 && z3 == res * c3
+@test sol_weigths == res * weigths && all(sol_weigths .<= capacity)
+z1a,z2a,z3a,sol_weigthsa,resa,nbSupporteda = solveKP(KP(c1,c2,c3,weigths,capacity), KP_Jorge2010_3obj_approx(0))
+@test z1a == z1 && z2a == z2 && z3a == z3 && nbSupporteda == nbSupported
+z1a,z2a,z3a,sol_weigthsa,resa,nbSupporteda = solveKP(KP(c1,c2,c3,weigths,capacity), KP_Jorge2010_3obj_approx(0.01))
+@test z1a == resa * c1 && z2a == resa * c2 && z3a == resa * c3 && all(sol_weigthsa .<= capacity)
+@test nbSupporteda == nbSupported && length(z1a) < length(z1)
+@test all(i -> any(j -> z1[i] <= 1.01*z1a[j] && z2[i] <= 1.01*z2a[j] && z3[i] <= 1.01*z3a[j], 1:length(z1a)), 1:length(z1))